@@ -0,0 +1,180 @@
+#!/usr/bin/env python3
+# Copyright (c) 2024 iSoftStone Education Co., Ltd.
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+"""Reference frames for the golden check of the host simulator.
+
+golden.txt only holds a hash per frame. make golden also writes the frames
+as PNG files named after the hash, so a frame repeated in the scenario or
+shared by both simulator builds is stored once. The PNG files are not
+committed: run make golden on the unmodified tree before changing the
+drawing code. The simulator writes its snapshots as NN_name.ppm, NN being
+the frame number.
+
+  golden_png.py update DIR SNAPSHOTS:GOLDEN ...
+      write DIR/<hash>.png for every frame of the golden files and remove
+      the PNG files no golden file refers to any more
+  golden_png.py diff DIR SNAPSHOTS GOLDEN OUT
+      for every snapshot that differs from its reference frame, print the
+      changed area and write OUT/NN_name.png: expected | actual | changes
+"""
+
+import os
+import struct
+import sys
+import zlib
+
+PNG_SIGNATURE = b'\x89PNG\r\n\x1a\n'
+GAP = 4
+
+
+def read_golden(path):
+    """Return [(name, hash)] in frame order."""
+    frames = []
+    with open(path) as f:
+        for line in f:
+            fields = line.split()
+            if len(fields) == 7 and fields[0] != 'frame':
+                frames.append((fields[0], fields[6]))
+    return frames
+
+
+def snapshot_path(snapshots, index, name):
+    return os.path.join(snapshots, '%02d_%s.ppm' % (index, name))
+
+
+def read_ppm(path):
+    with open(path, 'rb') as f:
+        data = f.read()
+    magic, size, maxval, pixels = data.split(b'\n', 3)
+    if magic != b'P6' or maxval != b'255':
+        raise ValueError('%s: not a 8-bit P6 file' % path)
+    width, height = map(int, size.split())
+    return width, height, pixels[:width * height * 3]
+
+
+def write_png(path, width, height, pixels):
+    def chunk(kind, body):
+        return struct.pack('>I', len(body)) + kind + body + struct.pack('>I', zlib.crc32(kind + body))
+
+    stride = width * 3
+    raw = b''.join(b'\0' + pixels[y * stride:(y + 1) * stride] for y in range(height))
+    with open(path, 'wb') as f:
+        f.write(PNG_SIGNATURE)
+        f.write(chunk(b'IHDR', struct.pack('>IIBBBBB', width, height, 8, 2, 0, 0, 0)))
+        f.write(chunk(b'IDAT', zlib.compress(raw, 9)))
+        f.write(chunk(b'IEND', b''))
+
+
+def read_png(path):
+    """Read the 8-bit RGB, unfiltered PNG files written by write_png."""
+    with open(path, 'rb') as f:
+        data = f.read()
+    if not data.startswith(PNG_SIGNATURE):
+        raise ValueError('%s: not a PNG file' % path)
+    pos, idat = len(PNG_SIGNATURE), b''
+    while pos < len(data):
+        length, kind = struct.unpack('>I4s', data[pos:pos + 8])
+        body = data[pos + 8:pos + 8 + length]
+        if kind == b'IHDR':
+            width, height = struct.unpack('>II', body[:8])
+        elif kind == b'IDAT':
+            idat += body
+        pos += 12 + length
+    raw = zlib.decompress(idat)
+    stride = width * 3 + 1
+    rows = [raw[y * stride:(y + 1) * stride] for y in range(height)]
+    if any(row[0] != 0 for row in rows):
+        raise ValueError('%s: filtered rows are not supported' % path)
+    return width, height, b''.join(row[1:] for row in rows)
+
+
+def update(directory, specs):
+    os.makedirs(directory, exist_ok=True)
+    used = set()
+    for spec in specs:
+        snapshots, golden = spec.split(':', 1)
+        for index, (name, digest) in enumerate(read_golden(golden)):
+            path = os.path.join(directory, digest + '.png')
+            if digest not in used and not os.path.exists(path):
+                write_png(path, *read_ppm(snapshot_path(snapshots, index, name)))
+            used.add(digest)
+    for entry in sorted(os.listdir(directory)):
+        if entry.endswith('.png') and entry[:-4] not in used:
+            os.remove(os.path.join(directory, entry))
+    return 0
+
+
+def compose(width, height, expected, actual):
+    """Expected and actual side by side, then the actual frame dimmed with changed pixels in red."""
+    out_width = width * 3 + GAP * 2
+    gap = b'\x80\x80\x80' * GAP
+    rows = []
+    for y in range(height):
+        exp = expected[y * width * 3:(y + 1) * width * 3]
+        act = actual[y * width * 3:(y + 1) * width * 3]
+        marked = bytearray()
+        for x in range(0, width * 3, 3):
+            if exp[x:x + 3] != act[x:x + 3]:
+                marked += b'\xff\x00\x00'
+            else:
+                marked += bytes(128 + c // 2 for c in act[x:x + 3])
+        rows.append(exp + gap + act + gap + bytes(marked))
+    return out_width, b''.join(rows)
+
+
+def diff(directory, snapshots, golden, out):
+    differ = 0
+    for index, (name, digest) in enumerate(read_golden(golden)):
+        snapshot = snapshot_path(snapshots, index, name)
+        reference = os.path.join(directory, digest + '.png')
+        if not os.path.exists(snapshot):
+            continue
+        if not os.path.exists(reference):
+            print('%02d %-16s no reference frame %s, run make golden on the unmodified tree'
+                  % (index, name, reference))
+            differ += 1
+            continue
+        width, height, actual = read_ppm(snapshot)
+        ref_width, ref_height, expected = read_png(reference)
+        if (width, height) != (ref_width, ref_height):
+            print('%02d %-16s size %dx%d, expected %dx%d' % (index, name, width, height, ref_width, ref_height))
+            differ += 1
+            continue
+        if actual == expected:
+            continue
+        changed = [i // 3 for i in range(0, len(actual), 3) if actual[i:i + 3] != expected[i:i + 3]]
+        if not changed:
+            continue
+        differ += 1
+        xs = [i % width for i in changed]
+        ys = [i // width for i in changed]
+        os.makedirs(out, exist_ok=True)
+        path = os.path.join(out, '%02d_%s.png' % (index, name))
+        out_width, pixels = compose(width, height, expected, actual)
+        write_png(path, out_width, height, pixels)
+        print('%02d %-16s %6d pixels differ in (%d,%d)-(%d,%d), see %s'
+              % (index, name, len(changed), min(xs), min(ys), max(xs), max(ys), path))
+    return 1 if differ else 0
+
+
+def main():
+    if len(sys.argv) >= 4 and sys.argv[1] == 'update':
+        return update(sys.argv[2], sys.argv[3:])
+    if len(sys.argv) == 6 and sys.argv[1] == 'diff':
+        return diff(*sys.argv[2:])
+    sys.stderr.write(__doc__)
+    return 2
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,22 @@
+/*
+ * Copyright (c) 2024 iSoftStone Education Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/* 主机模拟用：iot_errno.h */
+#ifndef _IOT_ERRNO_H_
+#define _IOT_ERRNO_H_
+
+#define IOT_SUCCESS         0
+#define IOT_FAILURE         1
+
+#endif /* _IOT_ERRNO_H_ */
@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2024 iSoftStone Education Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/* 主机模拟用：iot_gpio.h，只包含LCD驱动用到的引脚 */
+#ifndef _IOT_GPIO_H_
+#define _IOT_GPIO_H_
+
+typedef enum
+{
+    IOT_GPIO_VALUE0 = 0,
+    IOT_GPIO_VALUE1,
+} IotGpioValue;
+
+typedef enum
+{
+    IOT_GPIO_DIR_IN = 0,
+    IOT_GPIO_DIR_OUT,
+} IotGpioDir;
+
+enum
+{
+    GPIO0_PA4 = 4,
+    GPIO0_PC0 = 16,
+    GPIO0_PC1,
+    GPIO0_PC2,
+    GPIO0_PC3,
+};
+
+unsigned int IoTGpioInit(unsigned int id);
+unsigned int IoTGpioDeinit(unsigned int id);
+unsigned int IoTGpioSetDir(unsigned int id, IotGpioDir dir);
+unsigned int IoTGpioSetOutputVal(unsigned int id, IotGpioValue val);
+
+#endif /* _IOT_GPIO_H_ */
@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2024 iSoftStone Education Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/* 主机模拟用：iot_spi.h */
+#ifndef _IOT_SPI_H_
+#define _IOT_SPI_H_
+
+#include <stdint.h>
+
+enum { ESPI0_M1 = 0 };
+enum { SPI_MODE_MASTER = 0 };
+enum { SPI_DIRECTION_1LINE_TX = 0 };
+enum { SPI_DATASIZE_8BIT = 0 };
+enum { SPI_POLARITY_HIGH = 0 };
+enum { SPI_PHASE_2EDGE = 0 };
+enum { SPI_BAUDRATEPRESCALER_1 = 0 };
+enum { SPI_FIRSTBIT_MSB = 0 };
+
+typedef struct
+{
+    uint32_t Mode;
+    uint32_t Direction;
+    uint32_t DataSize;
+    uint32_t CLKPolarity;
+    uint32_t CLKPhase;
+    uint32_t BaudRatePrescaler;
+    uint32_t FirstBit;
+} IoT_SPI_InitTypeDef;
+
+unsigned int IoTSpiInit(unsigned int id, IoT_SPI_InitTypeDef *param);
+unsigned int IoTSpiDeinit(unsigned int id);
+unsigned int IoTSpiWrite(unsigned int id, uint8_t *buf, uint32_t len);
+
+#endif /* _IOT_SPI_H_ */
@@ -0,0 +1,25 @@
+/*
+ * Copyright (c) 2024 iSoftStone Education Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/* 主机模拟用：los_queue.h */
+#ifndef _LOS_QUEUE_H_
+#define _LOS_QUEUE_H_
+
+#include "los_task.h"
+
+uint32_t LOS_QueueCreate(char *queueName, uint16_t len, uint32_t *queueID, uint32_t flags, uint16_t maxMsgSize);
+uint32_t LOS_QueueReadCopy(uint32_t queueID, void *bufferAddr, uint32_t *bufferSize, uint32_t timeOut);
+uint32_t LOS_QueueWriteCopy(uint32_t queueID, void *bufferAddr, uint32_t bufferSize, uint32_t timeOut);
+
+#endif /* _LOS_QUEUE_H_ */
@@ -0,0 +1,25 @@
+/*
+ * Copyright (c) 2024 iSoftStone Education Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/* 主机模拟用：los_sem.h */
+#ifndef _LOS_SEM_H_
+#define _LOS_SEM_H_
+
+#include "los_task.h"
+
+uint32_t LOS_SemCreate(uint16_t count, uint32_t *semHandle);
+uint32_t LOS_SemPend(uint32_t semHandle, uint32_t timeout);
+uint32_t LOS_SemPost(uint32_t semHandle);
+
+#endif /* _LOS_SEM_H_ */
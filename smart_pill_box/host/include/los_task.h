@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2024 iSoftStone Education Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/* 主机模拟用：los_task.h，任务、队列、信号量由los_host.c用pthread实现 */
+#ifndef _LOS_TASK_H_
+#define _LOS_TASK_H_
+
+#include <stdint.h>
+
+#define LOS_OK                  0
+#define LOS_NOK                 1
+#define LOS_WAIT_FOREVER        0xFFFFFFFF
+#define LOS_NO_WAIT             0
+
+typedef void *(*TSK_ENTRY_FUNC)(uint32_t arg);
+
+typedef struct
+{
+    TSK_ENTRY_FUNC      pfnTaskEntry;
+    uint16_t            usTaskPrio;
+    uint32_t            uwArg;
+    uint32_t            uwStackSize;
+    char               *pcName;
+} TSK_INIT_PARAM_S;
+
+uint32_t LOS_TaskCreate(uint32_t *taskID, TSK_INIT_PARAM_S *initParam);
+void LOS_Msleep(uint32_t msecs);
+uint64_t LOS_TickCountGet(void);
+uint32_t LOS_MS2Tick(uint32_t millisec);
+
+#endif /* _LOS_TASK_H_ */
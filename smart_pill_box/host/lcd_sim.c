@@ -0,0 +1,404 @@
+/*
+ * Copyright (c) 2024 iSoftStone Education Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <stdio.h>
+#include <string.h>
+
+#include "lcd.h"
+#include "picture.h"
+#include "smart_box.h"
+#include "st7789_sim.h"
+
+/* 文件路径最大长度 */
+#define SIM_PATH_MAX        256
+/* 基准文件中最多的帧数 */
+#define SIM_FRAME_MAX       64
+#define SIM_NAME_MAX        32
+
+/***************************************************************
+* 名   称: sim_frame_t
+* 说    明: 基准文件(golden.txt)中的一帧，只比较显示内容的哈希，
+*           SPI字节数用于列出本次的变化
+***************************************************************/
+typedef struct
+{
+    char                name[SIM_NAME_MAX];
+    uint32_t            bytes;
+    uint64_t            hash;
+} sim_frame_t;
+
+static const char *m_out_dir = NULL;
+
+static sim_frame_t m_golden[SIM_FRAME_MAX];
+static int      m_golden_num = -1;      // -1为不与基准比较
+static FILE    *m_update = NULL;        // 重新生成的基准文件
+static uint32_t m_frame_num = 0;
+static uint32_t m_diff_num = 0;
+static uint64_t m_bytes = 0;
+static uint64_t m_golden_bytes = 0;
+
+/***************************************************************
+ * 函数名称: sim_load_golden
+ * 说    明: 读取基准文件，格式与输出的帧统计相同
+ * 参    数:
+ *       @path：文件路径
+ * 返 回 值: 返回0为成功，反之为失败
+ ***************************************************************/
+static int sim_load_golden(const char *path)
+{
+    FILE *f = fopen(path, "r");
+    char line[256];
+    sim_frame_t *g;
+    unsigned long long hash;
+
+    if (f == NULL)
+    {
+        fprintf(stderr, "failed to open %s\n", path);
+        return -1;
+    }
+
+    m_golden_num = 0;
+    while ((fgets(line, sizeof(line), f) != NULL) && (m_golden_num < SIM_FRAME_MAX))
+    {
+        g = &m_golden[m_golden_num];
+        /* 跳过表头和空行 */
+        if (sscanf(line, "%31s %*u %u %*u %*u %*u %llx", g->name, &g->bytes, &hash) != 3)
+        {
+            continue;
+        }
+        g->hash = hash;
+        m_golden_num++;
+    }
+    fclose(f);
+    return 0;
+}
+
+/***************************************************************
+ * 函数名称: sim_frame_end
+ * 说    明: 等待一帧数据发送完毕，输出总线统计并保存截图
+ * 参    数:
+ *       @name：帧名称，截图文件名为"帧序号_帧名称.ppm"
+ * 返 回 值: 无
+ ***************************************************************/
+static void sim_frame_end(const char *name)
+{
+    st7789_sim_stats_t stats;
+    char path[SIM_PATH_MAX];
+
+    const sim_frame_t *g;
+    uint64_t hash;
+
+    lcd_sync();
+    st7789_sim_get_stats(&stats);
+    hash = st7789_sim_hash();
+    printf("%-16s %8u %8u %8u %8u %8u  %016llx", name,
+        stats.spi_writes, stats.spi_bytes, stats.commands, stats.windows, stats.pixels,
+        (unsigned long long)hash);
+    if (m_update != NULL)
+    {
+        fprintf(m_update, "%-16s %8u %8u %8u %8u %8u  %016llx\n", name,
+            stats.spi_writes, stats.spi_bytes, stats.commands, stats.windows, stats.pixels,
+            (unsigned long long)hash);
+    }
+
+    /* 与基准中同一序号的帧比较：显示内容必须一致，字节数只列出变化 */
+    if (m_golden_num >= 0)
+    {
+        m_bytes += stats.spi_bytes;
+        g = ((int)m_frame_num < m_golden_num) ? &m_golden[m_frame_num] : NULL;
+        if ((g == NULL) || (strcmp(g->name, name) != 0))
+        {
+            printf("  %8s %7s  NEW", "-", "");
+            m_diff_num++;
+        }
+        else
+        {
+            m_golden_bytes += g->bytes;
+            printf("  %8u %+6.1f%%  %s", g->bytes,
+                (g->bytes != 0) ? (100.0 * stats.spi_bytes / g->bytes - 100.0) : 0.0,
+                (g->hash == hash) ? "OK" : "DIFF");
+            if (g->hash != hash)
+            {
+                m_diff_num++;
+            }
+        }
+    }
+    printf("\n");
+
+    /* 截图文件名前加帧序号，同名的帧不会互相覆盖 */
+    if (m_out_dir != NULL)
+    {
+        snprintf(path, sizeof(path), "%s/%02u_%s.ppm", m_out_dir, m_frame_num, name);
+        if (st7789_sim_dump_ppm(path) != 0)
+        {
+            fprintf(stderr, "failed to write %s\n", path);
+        }
+    }
+    m_frame_num++;
+    st7789_sim_reset_stats();
+}
+
+/***************************************************************
+ * 函数名称: sim_show
+ * 说    明: 绘制一帧界面
+ * 参    数:
+ *       @name：帧名称
+ *       @ui：界面数据
+ * 返 回 值: 无
+ ***************************************************************/
+static void sim_show(const char *name, const smart_box_ui_t *ui)
+{
+    lcd_show_ui(ui);
+    sim_frame_end(name);
+}
+
+/***************************************************************
+ * 函数名称: sim_check_background
+ * 说    明: 检查页面背景图与逐个绘制固定控件的结果是否一致
+ * 参    数: 无
+ * 返 回 值: 不一致的页面个数
+ ***************************************************************/
+static int sim_check_background(void)
+{
+    uint64_t hash;
+    uint8_t i;
+    int stale = 0;
+
+    for (i = 0; i < SMART_BOX_PAGE_NUM; i++)
+    {
+        lcd_show_background(i, 1);
+        lcd_flush();
+        lcd_sync();
+        hash = st7789_sim_hash();
+
+        lcd_show_background(i, 0);
+        lcd_flush();
+        lcd_sync();
+        if (st7789_sim_hash() != hash)
+        {
+            printf("page%u background is out of date, run 'make page_bg'\n", i);
+            stale++;
+        }
+    }
+    return stale;
+}
+
+int main(int argc, char **argv)
+{
+    smart_box_ui_t ui;
+    char name[32];
+    uint8_t i;
+    int arg;
+    int ret;
+
+    for (arg = 1; arg < argc; arg++)
+    {
+        if ((strcmp(argv[arg], "-c") == 0) && (arg + 1 < argc))
+        {
+            if (sim_load_golden(argv[++arg]) != 0)
+            {
+                return 1;
+            }
+        }
+        else if ((strcmp(argv[arg], "-u") == 0) && (arg + 1 < argc))
+        {
+            m_update = fopen(argv[++arg], "w");
+            if (m_update == NULL)
+            {
+                fprintf(stderr, "failed to write %s\n", argv[arg]);
+                return 1;
+            }
+        }
+        else if ((argv[arg][0] != '-') && (m_out_dir == NULL))
+        {
+            m_out_dir = argv[arg];
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [-c golden] [-u golden] [snapshot dir]\n"
+                "  -c  compare every frame with the golden file\n"
+                "  -u  write the golden file\n", argv[0]);
+            return 1;
+        }
+    }
+
+    printf("%-16s %8s %8s %8s %8s %8s  %-16s", "frame",
+        "writes", "bytes", "cmds", "addr", "pixels", "hash");
+    if (m_golden_num >= 0)
+    {
+        printf("  %8s %7s  %s", "golden", "bytes", "pixels");
+    }
+    printf("\n");
+    if (m_update != NULL)
+    {
+        fprintf(m_update, "%-16s %8s %8s %8s %8s %8s  %s\n", "frame",
+            "writes", "bytes", "cmds", "addr", "pixels", "hash");
+    }
+
+    st7789_sim_reset_stats();
+    lcd_dev_init();
+    sim_frame_end("init");
+
+    /* 示例数据 */
+    memset(&ui, 0, sizeof(ui));
+    ui.hour = 8;
+    ui.min = 30;
+    ui.lum = 123.45f;
+    ui.humi = 56.78f;
+    ui.temp = 25.5f;
+    ui.gas = 12.0f;
+    ui.storage_time[0] = 30;
+    ui.storage_time[1] = 7;
+    ui.storage_time[2] = 90;
+    ui.eat_1[0] = 1;
+    ui.eat_1[1] = 2;
+    ui.eat_1[2] = 1;
+    ui.eat_2[0] = 0;
+    ui.eat_2[1] = 1;
+    ui.eat_2[2] = 3;
+    ui.eat_3[0] = 2;
+    ui.eat_3[1] = 0;
+    ui.eat_3[2] = 1;
+    ui.eat_time[0][0] = 8;
+    ui.eat_time[0][1] = 0;
+    ui.eat_time[1][0] = 12;
+    ui.eat_time[1][1] = 30;
+    ui.eat_time[2][0] = 19;
+    ui.eat_time[2][1] = 45;
+
+    /* 页面0：药盒数量 */
+    ui.display = 0;
+    sim_show("page0", &ui);
+    sim_show("page0_same", &ui);
+    ui.eat_index = 1;
+    sim_show("page0_next", &ui);
+
+    /* 页面1：环境数据 */
+    ui.display = 1;
+    sim_show("page1", &ui);
+    ui.min = 31;
+    ui.temp = 25.62f;
+    ui.humi = 57.1f;
+    sim_show("page1_update", &ui);
+    /* 环境数据曲线，超过一屏后循环覆盖，新增一个采样只绘制两列 */
+    for (i = 0; i < 80; i++)
+    {
+        lcd_add_sensor(100.0f + i * 2, 50.0f + i % 20, 20.0f + (i % 10) * 0.8f, 10.0f + (i % 7) * 5);
+    }
+    sim_show("page1_chart", &ui);
+    lcd_add_sensor(140.0f, 55.0f, 24.0f, 60.0f);
+    sim_show("page1_sample", &ui);
+    /* 超出控件位数的数值显示最大值，不回绕 */
+    ui.lum = 1234.5f;
+    ui.humi = 100.0f;
+    sim_show("page1_clamp", &ui);
+
+    /* 页面2：设置，依次移动选中项 */
+    ui.display = 2;
+    for (i = 0; i < 19; i++)
+    {
+        ui.dis2 = i;
+        snprintf(name, sizeof(name), "page2_sel%02u", i);
+        sim_show(name, &ui);
+    }
+    ui.eat_3[2]++;
+    sim_show("page2_edit", &ui);
+
+    /* 页面3：记录，新增一条只绘制一行，超过一屏后循环 */
+    lcd_add_history("08:00 dose 1 alarm");
+    lcd_add_history("08:01 dose 1 box open");
+    lcd_add_history("08:01 dose 1 taken (key)");
+    ui.display = 3;
+    sim_show("page3", &ui);
+    lcd_add_history("08:30 env alarm T25.5 H56.8 G12.0");
+    sim_show("page3_add", &ui);
+    for (i = 0; i < 12; i++)
+    {
+        snprintf(name, sizeof(name), "%02u:%02u dose %u alarm", 12 + i, i * 5, i % 3 + 1);
+        lcd_add_history(name);
+        sim_show((i < 11) ? "page3_fill" : "page3_wrap", &ui);
+    }
+
+    ui.display = 0;
+    sim_show("page0_back", &ui);
+
+    /* 显示状态：调低亮度内容不变；休眠时不绘制，屏幕为黑；
+     * 唤醒后显存内容仍在，只绘制休眠期间的变化 */
+    ui.power = LCD_POWER_DIM;
+    sim_show("dim", &ui);
+    ui.power = LCD_POWER_SLEEP;
+    ui.eat_index = 2;
+    sim_show("sleep", &ui);
+    ui.power = LCD_POWER_ON;
+    sim_show("wake", &ui);
+
+    /* 原始图片，宽高取自文件头；不使用显存且为RGB565时直接从flash发送 */
+    lcd_set_pixel_format(LCD_PIXEL_RGB565);
+    lcd_show_image(0, 0, temperature_picture);
+    lcd_flush();
+    sim_frame_end("image");
+
+    /* 页面1的四个图标以原始图片画在原位置，页面中图标已画进背景，
+     * 这里检查flash直接发送：启用显存时完全在图片内的区块不再从显存发送 */
+    lcd_fill(0, 0, LCD_W, LCD_H, LCD_WHITE);
+    lcd_show_image(0, 0, Light_picture);
+    lcd_show_image(84, 0, humidity_picture);
+    lcd_show_image(168, 0, temperature_picture);
+    lcd_show_image(252, 0, gas_picture);
+    lcd_flush();
+    sim_frame_end("image_icons");
+
+    /* 页面以RGB444发送的效果，颜色和抗锯齿边缘的偏差见截图；页面都使用RGB565 */
+    lcd_set_pixel_format(LCD_PIXEL_RGB444);
+    for (i = 0; i < SMART_BOX_PAGE_NUM; i++)
+    {
+        if (i == 1)
+        {
+            continue;
+        }
+        /* 先清屏，启用显存时整页都重新发送 */
+        lcd_fill(0, 0, LCD_W, LCD_H, LCD_BLACK);
+        lcd_show_background(i, 1);
+        lcd_flush();
+        snprintf(name, sizeof(name), "page%u_rgb444", i);
+        sim_frame_end(name);
+    }
+    lcd_set_pixel_format(LCD_PIXEL_RGB565);
+
+    /* 驱动自身的统计，应与模拟器统计的最后一帧一致 */
+    lcd_stat_print("lcd_stat");
+
+    ret = (sim_check_background() == 0) ? 0 : 1;
+
+    if (m_update != NULL)
+    {
+        fclose(m_update);
+    }
+    if (m_golden_num >= 0)
+    {
+        if ((int)m_frame_num != m_golden_num)
+        {
+            printf("golden has %d frames, ran %u\n", m_golden_num, m_frame_num);
+            m_diff_num++;
+        }
+        printf("golden: %u frames, %u differ, spi bytes %llu -> %llu (%+.1f%%)\n",
+            m_frame_num, m_diff_num, (unsigned long long)m_golden_bytes, (unsigned long long)m_bytes,
+            (m_golden_bytes != 0) ? (100.0 * m_bytes / m_golden_bytes - 100.0) : 0.0);
+        if (m_diff_num != 0)
+        {
+            ret = 1;
+        }
+    }
+    return ret;
+}
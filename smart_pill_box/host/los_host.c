@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2024 iSoftStone Education Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "los_task.h"
+#include "los_queue.h"
+#include "los_sem.h"
+
+/* 主机模拟用的LiteOS接口，只实现LCD驱动用到的部分 */
+#define HOST_SEM_MAX        16
+#define HOST_QUEUE_MAX      8
+
+typedef struct
+{
+    pthread_mutex_t     lock;
+    pthread_cond_t      cond;
+    uint32_t            count;
+} host_sem_t;
+
+typedef struct
+{
+    pthread_mutex_t     lock;
+    pthread_cond_t      cond;
+    uint16_t            len;
+    uint16_t            size;
+    uint16_t            head;
+    uint16_t            used;
+    uint8_t            *buf;
+} host_queue_t;
+
+typedef struct
+{
+    TSK_ENTRY_FUNC      entry;
+    uint32_t            arg;
+} host_task_t;
+
+static host_sem_t   m_sems[HOST_SEM_MAX];
+static uint32_t     m_sem_count = 0;
+static host_queue_t m_queues[HOST_QUEUE_MAX];
+static uint32_t     m_queue_count = 0;
+static uint32_t     m_task_count = 0;
+
+static void *host_task_entry(void *arg)
+{
+    host_task_t task = *(host_task_t *)arg;
+
+    free(arg);
+    task.entry(task.arg);
+    return NULL;
+}
+
+uint32_t LOS_TaskCreate(uint32_t *taskID, TSK_INIT_PARAM_S *initParam)
+{
+    pthread_t thread;
+    host_task_t *task = malloc(sizeof(host_task_t));
+
+    if (task == NULL)
+    {
+        return LOS_NOK;
+    }
+    task->entry = initParam->pfnTaskEntry;
+    task->arg = initParam->uwArg;
+    if (pthread_create(&thread, NULL, host_task_entry, task) != 0)
+    {
+        free(task);
+        return LOS_NOK;
+    }
+    pthread_detach(thread);
+    *taskID = m_task_count++;
+    return LOS_OK;
+}
+
+/* 模拟器中不需要等待LCD复位等延时 */
+void LOS_Msleep(uint32_t msecs)
+{
+    (void)msecs;
+}
+
+uint64_t LOS_TickCountGet(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+uint32_t LOS_MS2Tick(uint32_t millisec)
+{
+    return millisec;
+}
+
+uint32_t LOS_SemCreate(uint16_t count, uint32_t *semHandle)
+{
+    host_sem_t *sem;
+
+    if (m_sem_count >= HOST_SEM_MAX)
+    {
+        return LOS_NOK;
+    }
+    sem = &m_sems[m_sem_count];
+    pthread_mutex_init(&sem->lock, NULL);
+    pthread_cond_init(&sem->cond, NULL);
+    sem->count = count;
+    *semHandle = m_sem_count++;
+    return LOS_OK;
+}
+
+uint32_t LOS_SemPend(uint32_t semHandle, uint32_t timeout)
+{
+    host_sem_t *sem = &m_sems[semHandle];
+    uint32_t ret = LOS_OK;
+
+    pthread_mutex_lock(&sem->lock);
+    while ((sem->count == 0) && (timeout != LOS_NO_WAIT))
+    {
+        pthread_cond_wait(&sem->cond, &sem->lock);
+    }
+    if (sem->count > 0)
+    {
+        sem->count--;
+    }
+    else
+    {
+        ret = LOS_NOK;
+    }
+    pthread_mutex_unlock(&sem->lock);
+    return ret;
+}
+
+uint32_t LOS_SemPost(uint32_t semHandle)
+{
+    host_sem_t *sem = &m_sems[semHandle];
+
+    pthread_mutex_lock(&sem->lock);
+    sem->count++;
+    pthread_cond_broadcast(&sem->cond);
+    pthread_mutex_unlock(&sem->lock);
+    return LOS_OK;
+}
+
+uint32_t LOS_QueueCreate(char *queueName, uint16_t len, uint32_t *queueID, uint32_t flags, uint16_t maxMsgSize)
+{
+    host_queue_t *queue;
+
+    (void)queueName;
+    (void)flags;
+    if (m_queue_count >= HOST_QUEUE_MAX)
+    {
+        return LOS_NOK;
+    }
+    queue = &m_queues[m_queue_count];
+    queue->buf = calloc(len, maxMsgSize);
+    if (queue->buf == NULL)
+    {
+        return LOS_NOK;
+    }
+    pthread_mutex_init(&queue->lock, NULL);
+    pthread_cond_init(&queue->cond, NULL);
+    queue->len = len;
+    queue->size = maxMsgSize;
+    queue->head = 0;
+    queue->used = 0;
+    *queueID = m_queue_count++;
+    return LOS_OK;
+}
+
+uint32_t LOS_QueueReadCopy(uint32_t queueID, void *bufferAddr, uint32_t *bufferSize, uint32_t timeOut)
+{
+    host_queue_t *queue = &m_queues[queueID];
+    uint32_t size;
+
+    pthread_mutex_lock(&queue->lock);
+    while ((queue->used == 0) && (timeOut != LOS_NO_WAIT))
+    {
+        pthread_cond_wait(&queue->cond, &queue->lock);
+    }
+    if (queue->used == 0)
+    {
+        pthread_mutex_unlock(&queue->lock);
+        return LOS_NOK;
+    }
+    size = (*bufferSize < queue->size) ? *bufferSize : queue->size;
+    memcpy(bufferAddr, queue->buf + (uint32_t)queue->head * queue->size, size);
+    *bufferSize = size;
+    queue->head = (queue->head + 1) % queue->len;
+    queue->used--;
+    pthread_cond_broadcast(&queue->cond);
+    pthread_mutex_unlock(&queue->lock);
+    return LOS_OK;
+}
+
+uint32_t LOS_QueueWriteCopy(uint32_t queueID, void *bufferAddr, uint32_t bufferSize, uint32_t timeOut)
+{
+    host_queue_t *queue = &m_queues[queueID];
+    uint32_t tail;
+
+    pthread_mutex_lock(&queue->lock);
+    while ((queue->used == queue->len) && (timeOut != LOS_NO_WAIT))
+    {
+        pthread_cond_wait(&queue->cond, &queue->lock);
+    }
+    if (queue->used == queue->len)
+    {
+        pthread_mutex_unlock(&queue->lock);
+        return LOS_NOK;
+    }
+    tail = (queue->head + queue->used) % queue->len;
+    memcpy(queue->buf + tail * queue->size, bufferAddr,
+        (bufferSize < queue->size) ? bufferSize : queue->size);
+    queue->used++;
+    pthread_cond_broadcast(&queue->cond);
+    pthread_mutex_unlock(&queue->lock);
+    return LOS_OK;
+}
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2024 iSoftStone Education Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <stdio.h>
+
+#include "lcd.h"
+#include "smart_box.h"
+#include "st7789_sim.h"
+
+/* Image2Lcd图片头：扫描方式、灰度、宽、高(大端)等共8字节 */
+#define BG_HEADER_LEN       8
+
+/***************************************************************
+ * 函数名称: bg_write_page
+ * 说    明: 把屏幕内容按Image2Lcd格式(RGB565，高字节在前)写成C数组
+ * 参    数:
+ *       @fp：输出文件
+ *       @display：页面
+ * 返 回 值: 无
+ ***************************************************************/
+static void bg_write_page(FILE *fp, uint8_t display)
+{
+    uint16_t width, height, x, y, color;
+    uint32_t n = 0;
+
+    st7789_sim_size(&width, &height);
+    fprintf(fp, "const unsigned char page%u_bg[%u] =\n{\n", display,
+        BG_HEADER_LEN + (uint32_t)width * height * 2);
+    fprintf(fp, "    0x00, 0x10, 0x%02X, 0x%02X, 0x%02X, 0x%02X, 0x00, 0x1B,\n",
+        width >> 8, width & 0xFF, height >> 8, height & 0xFF);
+    for (y = 0; y < height; y++)
+    {
+        for (x = 0; x < width; x++)
+        {
+            color = st7789_sim_pixel(x, y);
+            fprintf(fp, "%s0x%02X, 0x%02X,", (n % 8 == 0) ? "    " : " ", color >> 8, color & 0xFF);
+            if (++n % 8 == 0)
+            {
+                fprintf(fp, "\n");
+            }
+        }
+    }
+    fprintf(fp, "%s};\n\n", (n % 8 == 0) ? "" : "\n");
+}
+
+int main(int argc, char **argv)
+{
+    FILE *fp;
+    uint8_t i;
+
+    if (argc != 2)
+    {
+        fprintf(stderr, "usage: %s <output.c>\n", argv[0]);
+        return 1;
+    }
+
+    fp = fopen(argv[1], "w");
+    if (fp == NULL)
+    {
+        fprintf(stderr, "failed to write %s\n", argv[1]);
+        return 1;
+    }
+
+    lcd_dev_init();
+    fprintf(fp, "/* Generated by host/page_bg from the fixed widgets in smart_box.c. */\n\n");
+    for (i = 0; i < SMART_BOX_PAGE_NUM; i++)
+    {
+        /* 逐个绘制固定控件，截取整个屏幕 */
+        lcd_show_background(i, 0);
+        lcd_flush();
+        lcd_sync();
+        bg_write_page(fp, i);
+    }
+    fclose(fp);
+
+    return 0;
+}
@@ -0,0 +1,434 @@
+/*
+ * Copyright (c) 2024 iSoftStone Education Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "iot_errno.h"
+#include "iot_gpio.h"
+#include "iot_spi.h"
+#include "st7789_sim.h"
+
+/* LCD驱动使用的DC引脚，低电平为命令，高电平为数据 */
+#define SIM_PIN_DC          GPIO0_PA4
+
+/* 0x36(MADCTL)各位 */
+#define MADCTL_MY           0x80
+#define MADCTL_MX           0x40
+#define MADCTL_MV           0x20
+
+/* 0x3A(COLMOD)像素格式 */
+#define COLMOD_12BIT        0x03
+#define COLMOD_16BIT        0x05
+#define COLMOD_18BIT        0x06
+
+/* 控制器状态 */
+static uint16_t m_gram[ST7789_SIM_ROWS][ST7789_SIM_COLS];
+static uint8_t  m_dc = 1;
+static uint8_t  m_cmd = 0;
+static uint8_t  m_param[6];
+static uint8_t  m_param_len = 0;
+static uint16_t m_xs = 0, m_xe = ST7789_SIM_COLS - 1;
+static uint16_t m_ys = 0, m_ye = ST7789_SIM_ROWS - 1;
+static uint16_t m_cx = 0, m_cy = 0;
+static uint8_t  m_madctl = 0;
+static uint8_t  m_colmod = COLMOD_16BIT;
+static uint8_t  m_sleep = 1;
+static uint8_t  m_display_on = 0;
+
+/* 垂直滚动：显存行分为上固定区、滚动区、下固定区 */
+static uint16_t m_tfa = 0;
+static uint16_t m_vsa = ST7789_SIM_ROWS;
+static uint16_t m_vsp = 0;
+
+/* 像素拼装：RAMWR数据按像素格式拆分 */
+static uint32_t m_bits = 0;
+static uint8_t  m_nbits = 0;
+
+static st7789_sim_stats_t m_stats;
+/* 发送任务与读取统计的任务可能不同 */
+static pthread_mutex_t m_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/***************************************************************
+ * 函数名称: sim_gram_pos
+ * 说    明: 按MADCTL将窗口坐标转换为显存位置
+ * 参    数:
+ *       @x,y：窗口坐标(列地址，行地址)
+ *       @row,col：返回显存行列
+ * 返 回 值: 1为在显存范围内，0为超出
+ ***************************************************************/
+static int sim_gram_pos(uint16_t x, uint16_t y, uint16_t *row, uint16_t *col)
+{
+    uint16_t c = x, r = y;
+
+    if (m_madctl & MADCTL_MV)
+    {
+        c = y;
+        r = x;
+    }
+    if ((c >= ST7789_SIM_COLS) || (r >= ST7789_SIM_ROWS))
+    {
+        return 0;
+    }
+    if (m_madctl & MADCTL_MX)
+    {
+        c = ST7789_SIM_COLS - 1 - c;
+    }
+    if (m_madctl & MADCTL_MY)
+    {
+        r = ST7789_SIM_ROWS - 1 - r;
+    }
+    *row = r;
+    *col = c;
+    return 1;
+}
+
+/***************************************************************
+ * 函数名称: sim_scroll_row
+ * 说    明: 按VSCRDEF/VSCSAD计算屏幕第row行显示的显存行
+ * 参    数:
+ *       @row：屏幕扫描行
+ * 返 回 值: 显存行
+ ***************************************************************/
+static uint16_t sim_scroll_row(uint16_t row)
+{
+    if ((m_vsa == 0) || (row < m_tfa) || (row >= m_tfa + m_vsa))
+    {
+        return row;
+    }
+    /* 滚动区第一行显示VSP所指的显存行，之后依次循环 */
+    return m_tfa + (uint16_t)(((int32_t)m_vsp - m_tfa + (row - m_tfa) + m_vsa) % m_vsa);
+}
+
+static void sim_put_pixel(uint16_t color)
+{
+    uint16_t row, col;
+
+    if (sim_gram_pos(m_cx, m_cy, &row, &col))
+    {
+        m_gram[row][col] = color;
+    }
+    m_stats.pixels++;
+
+    /* 写到窗口行尾换行，写到窗口末尾回到起点 */
+    if (++m_cx > m_xe)
+    {
+        m_cx = m_xs;
+        if (++m_cy > m_ye)
+        {
+            m_cy = m_ys;
+        }
+    }
+}
+
+static void sim_pixel_data(uint8_t dat)
+{
+    uint32_t p;
+    uint16_t r, g, b;
+
+    m_bits = (m_bits << 8) | dat;
+    m_nbits += 8;
+
+    switch (m_colmod & 0x07)
+    {
+        case COLMOD_12BIT:
+            /* 3字节2个像素，RGB各4位，扩展为RGB565 */
+            while (m_nbits >= 12)
+            {
+                m_nbits -= 12;
+                p = (m_bits >> m_nbits) & 0xFFF;
+                r = (p >> 8) & 0x0F;
+                g = (p >> 4) & 0x0F;
+                b = p & 0x0F;
+                sim_put_pixel((uint16_t)(((r << 1) | (r >> 3)) << 11 | ((g << 2) | (g >> 2)) << 5 | ((b << 1) | (b >> 3))));
+            }
+            break;
+        case COLMOD_18BIT:
+            /* 每个像素3字节，每字节高6位有效 */
+            if (m_nbits >= 24)
+            {
+                m_nbits = 0;
+                sim_put_pixel((uint16_t)((((m_bits >> 19) & 0x1F) << 11) | (((m_bits >> 10) & 0x3F) << 5) | ((m_bits >> 3) & 0x1F)));
+            }
+            break;
+        default:
+            if (m_nbits >= 16)
+            {
+                m_nbits = 0;
+                sim_put_pixel((uint16_t)(m_bits & 0xFFFF));
+            }
+            break;
+    }
+}
+
+static void sim_command(uint8_t cmd)
+{
+    m_cmd = cmd;
+    m_param_len = 0;
+    m_stats.commands++;
+
+    switch (cmd)
+    {
+        case 0x10:
+            m_sleep = 1;
+            break;
+        case 0x11:
+            m_sleep = 0;
+            break;
+        case 0x28:
+            m_display_on = 0;
+            break;
+        case 0x29:
+            m_display_on = 1;
+            break;
+        case 0x2A:
+        case 0x2B:
+            m_stats.windows++;
+            break;
+        case 0x2C:
+            m_cx = m_xs;
+            m_cy = m_ys;
+            m_nbits = 0;
+            break;
+        case 0x3C:
+            m_nbits = 0;
+            break;
+        default:
+            break;
+    }
+}
+
+static void sim_data(uint8_t dat)
+{
+    switch (m_cmd)
+    {
+        case 0x2A:
+        case 0x2B:
+            if (m_param_len < 4)
+            {
+                m_param[m_param_len++] = dat;
+            }
+            if (m_param_len == 4)
+            {
+                if (m_cmd == 0x2A)
+                {
+                    m_xs = (m_param[0] << 8) | m_param[1];
+                    m_xe = (m_param[2] << 8) | m_param[3];
+                }
+                else
+                {
+                    m_ys = (m_param[0] << 8) | m_param[1];
+                    m_ye = (m_param[2] << 8) | m_param[3];
+                }
+            }
+            break;
+        case 0x33:
+            if (m_param_len < 6)
+            {
+                m_param[m_param_len++] = dat;
+            }
+            if (m_param_len == 6)
+            {
+                m_tfa = (m_param[0] << 8) | m_param[1];
+                m_vsa = (m_param[2] << 8) | m_param[3];
+            }
+            break;
+        case 0x37:
+            if (m_param_len < 2)
+            {
+                m_param[m_param_len++] = dat;
+            }
+            if (m_param_len == 2)
+            {
+                m_vsp = (m_param[0] << 8) | m_param[1];
+            }
+            break;
+        case 0x2C:
+        case 0x3C:
+            sim_pixel_data(dat);
+            break;
+        case 0x36:
+            m_madctl = dat;
+            break;
+        case 0x3A:
+            m_colmod = dat;
+            break;
+        default:
+            break;
+    }
+}
+
+/////////////////////////////////////////////////////////////////
+/* SPI和GPIO接口 */
+
+unsigned int IoTGpioInit(unsigned int id)
+{
+    (void)id;
+    return IOT_SUCCESS;
+}
+
+unsigned int IoTGpioDeinit(unsigned int id)
+{
+    (void)id;
+    return IOT_SUCCESS;
+}
+
+unsigned int IoTGpioSetDir(unsigned int id, IotGpioDir dir)
+{
+    (void)id;
+    (void)dir;
+    return IOT_SUCCESS;
+}
+
+unsigned int IoTGpioSetOutputVal(unsigned int id, IotGpioValue val)
+{
+    pthread_mutex_lock(&m_lock);
+    m_stats.gpio_writes++;
+    if (id == SIM_PIN_DC)
+    {
+        m_dc = (val == IOT_GPIO_VALUE1);
+    }
+    pthread_mutex_unlock(&m_lock);
+    return IOT_SUCCESS;
+}
+
+unsigned int IoTSpiInit(unsigned int id, IoT_SPI_InitTypeDef *param)
+{
+    (void)id;
+    (void)param;
+    return IOT_SUCCESS;
+}
+
+unsigned int IoTSpiDeinit(unsigned int id)
+{
+    (void)id;
+    return IOT_SUCCESS;
+}
+
+unsigned int IoTSpiWrite(unsigned int id, uint8_t *buf, uint32_t len)
+{
+    uint32_t i;
+
+    (void)id;
+    pthread_mutex_lock(&m_lock);
+    m_stats.spi_writes++;
+    m_stats.spi_bytes += len;
+    for (i = 0; i < len; i++)
+    {
+        if (m_dc)
+        {
+            sim_data(buf[i]);
+        }
+        else
+        {
+            sim_command(buf[i]);
+        }
+    }
+    pthread_mutex_unlock(&m_lock);
+    return IOT_SUCCESS;
+}
+
+/////////////////////////////////////////////////////////////////
+
+void st7789_sim_reset_stats(void)
+{
+    pthread_mutex_lock(&m_lock);
+    memset(&m_stats, 0, sizeof(m_stats));
+    pthread_mutex_unlock(&m_lock);
+}
+
+
+void st7789_sim_get_stats(st7789_sim_stats_t *stats)
+{
+    pthread_mutex_lock(&m_lock);
+    *stats = m_stats;
+    pthread_mutex_unlock(&m_lock);
+}
+
+
+void st7789_sim_size(uint16_t *width, uint16_t *height)
+{
+    if (m_madctl & MADCTL_MV)
+    {
+        *width = ST7789_SIM_ROWS;
+        *height = ST7789_SIM_COLS;
+    }
+    else
+    {
+        *width = ST7789_SIM_COLS;
+        *height = ST7789_SIM_ROWS;
+    }
+}
+
+
+uint16_t st7789_sim_pixel(uint16_t x, uint16_t y)
+{
+    uint16_t row, col;
+
+    if (m_sleep || !m_display_on || !sim_gram_pos(x, y, &row, &col))
+    {
+        return 0x0000;
+    }
+    return m_gram[sim_scroll_row(row)][col];
+}
+
+
+uint64_t st7789_sim_hash(void)
+{
+    uint64_t hash = 0xCBF29CE484222325ULL;
+    uint16_t width, height, x, y, color;
+
+    st7789_sim_size(&width, &height);
+    for (y = 0; y < height; y++)
+    {
+        for (x = 0; x < width; x++)
+        {
+            color = st7789_sim_pixel(x, y);
+            hash = (hash ^ (color >> 8)) * 0x100000001B3ULL;
+            hash = (hash ^ (color & 0xFF)) * 0x100000001B3ULL;
+        }
+    }
+    return hash;
+}
+
+
+int st7789_sim_dump_ppm(const char *path)
+{
+    FILE *fp;
+    uint16_t width, height, x, y, color;
+    uint8_t rgb[3];
+
+    fp = fopen(path, "wb");
+    if (fp == NULL)
+    {
+        return -1;
+    }
+
+    st7789_sim_size(&width, &height);
+    fprintf(fp, "P6\n%u %u\n255\n", width, height);
+    for (y = 0; y < height; y++)
+    {
+        for (x = 0; x < width; x++)
+        {
+            color = st7789_sim_pixel(x, y);
+            rgb[0] = ((color >> 11) & 0x1F) * 255 / 31;
+            rgb[1] = ((color >> 5) & 0x3F) * 255 / 63;
+            rgb[2] = (color & 0x1F) * 255 / 31;
+            fwrite(rgb, 1, sizeof(rgb), fp);
+        }
+    }
+    fclose(fp);
+    return 0;
+}
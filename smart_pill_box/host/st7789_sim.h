@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2024 iSoftStone Education Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef _ST7789_SIM_H_
+#define _ST7789_SIM_H_
+
+#include <stdint.h>
+
+/* ST7789显存大小(竖屏方向) */
+#define ST7789_SIM_COLS     240
+#define ST7789_SIM_ROWS     320
+
+/***************************************************************
+* 名   称: st7789_sim_stats_t
+* 说    明: 总线统计，由st7789_sim_reset_stats清零
+***************************************************************/
+typedef struct
+{
+    uint32_t            spi_writes;     // IoTSpiWrite调用次数
+    uint32_t            spi_bytes;      // SPI发送的字节数
+    uint32_t            commands;       // 命令字节数
+    uint32_t            windows;        // 地址设置命令个数(0x2A和0x2B各计一次)
+    uint32_t            pixels;         // 写入显存的像素个数
+    uint32_t            gpio_writes;    // IoTGpioSetOutputVal调用次数
+} st7789_sim_stats_t;
+
+
+/***************************************************************
+ * 函数名称: st7789_sim_reset_stats
+ * 说    明: 清零总线统计
+ * 参    数: 无
+ * 返 回 值: 无
+ ***************************************************************/
+void st7789_sim_reset_stats(void);
+
+
+/***************************************************************
+ * 函数名称: st7789_sim_get_stats
+ * 说    明: 获取总线统计
+ * 参    数:
+ *       @stats：返回统计数据
+ * 返 回 值: 无
+ ***************************************************************/
+void st7789_sim_get_stats(st7789_sim_stats_t *stats);
+
+
+/***************************************************************
+ * 函数名称: st7789_sim_size
+ * 说    明: 按当前0x36(MADCTL)设置获取屏幕显示尺寸
+ * 参    数:
+ *       @width：返回宽度
+ *       @height：返回高度
+ * 返 回 值: 无
+ ***************************************************************/
+void st7789_sim_size(uint16_t *width, uint16_t *height);
+
+
+/***************************************************************
+ * 函数名称: st7789_sim_pixel
+ * 说    明: 读取屏幕上显示的像素(按当前屏幕方向的坐标，含垂直滚动)
+ * 参    数:
+ *       @x：X坐标
+ *       @y：Y坐标
+ * 返 回 值: RGB565颜色，屏幕关闭或休眠时为黑色
+ ***************************************************************/
+uint16_t st7789_sim_pixel(uint16_t x, uint16_t y);
+
+
+/***************************************************************
+ * 函数名称: st7789_sim_hash
+ * 说    明: 计算屏幕显示内容的哈希值，用于比较两次显示是否一致
+ * 参    数: 无
+ * 返 回 值: FNV-1a 64位哈希
+ ***************************************************************/
+uint64_t st7789_sim_hash(void);
+
+
+/***************************************************************
+ * 函数名称: st7789_sim_dump_ppm
+ * 说    明: 将屏幕显示内容保存为PPM(P6)图片
+ * 参    数:
+ *       @path：文件路径
+ * 返 回 值: 返回0为成功，反之为失败
+ ***************************************************************/
+int st7789_sim_dump_ppm(const char *path);
+
+#endif /* _ST7789_SIM_H_ */
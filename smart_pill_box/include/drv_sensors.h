@@ -2,6 +2,7 @@
 #define __DRV_SENSORS_H__
 
 #include <stdbool.h>
+#include <stdint.h>
 
 #define MPU6050_GYRO_OUT 0x43        // MPU6050陀螺仪数据寄存器地址
 #define MPU6050_ACC_OUT 0x3B         // MPU6050加速度数据寄存器地址
@@ -23,7 +24,7 @@
 #define MPU6050_RA_PWR_MGMT_1 0x6B
 #define MPU6050_RA_WHO_AM_I 0x75
 
-void mpu6050_read_data(short *dat);
+uint32_t mpu6050_read_data(short *dat);
 
 void i2c_dev_init(void);
 void bh1750_read_data(double *dat);
@@ -29,6 +29,14 @@
 #define LCD_H 240
 #endif
 
+/* 硬件滚动沿显存的320行方向进行：竖屏时为屏幕Y方向，横屏时为屏幕X方向 */
+#define LCD_SCROLL_LINES    320
+#if ((USE_HORIZONTAL==0) || (USE_HORIZONTAL==1))
+#define LCD_SCROLL_VERTICAL 1
+#else
+#define LCD_SCROLL_VERTICAL 0
+#endif
+
 /* 画笔颜色 */
 #define LCD_WHITE           0xFFFF
 #define LCD_BLACK           0x0000
@@ -52,6 +60,72 @@
 #define LCD_LGRAYBLUE       0XA651 //浅灰蓝色(中间层颜色)
 #define LCD_LBBLUE          0X2B12 //浅棕蓝色(选择条目的反色)
 
+/* 像素格式(0x3A)，见lcd_set_pixel_format */
+#define LCD_PIXEL_RGB565    0x05    // 16位/像素，每个像素2字节
+#define LCD_PIXEL_RGB444    0x03    // 12位/像素，每两个像素3字节
+
+/* 显示状态，见lcd_set_power */
+#define LCD_POWER_ON        0       // 正常显示
+#define LCD_POWER_DIM       1       // 调低亮度显示，只在背光接到LEDPWM引脚时有效
+#define LCD_POWER_SLEEP     2       // 关闭显示并休眠，显示内容保留
+
+/* 数字显示函数最多显示的位数 */
+#define LCD_NUM_MAX         12
+
+/* Image2Lcd生成的图片数组前8字节为文件头：扫描方式、颜色位数、
+ * 宽度、高度(高字节在前)、是否RGB565、颜色顺序，之后为RGB565像素(高字节在前) */
+#define LCD_IMAGE_HEADER_SIZE   8
+#define LCD_IMAGE_BITS          16
+#define LCD_IMAGE_WIDTH(img)    ((uint16_t)(((img)[2] << 8) | (img)[3]))
+#define LCD_IMAGE_HEIGHT(img)   ((uint16_t)(((img)[4] << 8) | (img)[5]))
+
+/* 压缩图片数据流：控制字节低7位为像素个数减1，
+ * 最高位为1时后跟1个调色板索引(重复count次)，为0时后跟count个调色板索引 */
+#define LCD_RLE_RUN         0x80
+#define LCD_RLE_COUNT_MASK  0x7F
+
+/***************************************************************
+* 名   称: lcd_picture_rle_t
+* 说    明: 调色板+RLE压缩图片，由tools/picture_rle.py生成
+***************************************************************/
+typedef struct
+{
+    uint16_t            width;          // 图片宽度
+    uint16_t            height;         // 图片高度
+    uint16_t            palette_size;   // 调色板颜色个数
+    const uint16_t     *palette;        // 调色板(RGB565)
+    uint32_t            data_len;       // 压缩数据长度
+    const uint8_t      *data;           // 压缩数据
+} lcd_picture_rle_t;
+
+/* 绘图统计类别 */
+typedef enum
+{
+    LCD_STAT_OTHER = 0,     // 不在绘图函数中发送的数据(如初始化)
+    LCD_STAT_FILL,          // lcd_fill、lcd_fill_rectangle
+    LCD_STAT_POINT,         // lcd_draw_point
+    LCD_STAT_LINE,          // 直线
+    LCD_STAT_SHAPE,         // 矩形、圆、三角形
+    LCD_STAT_TEXT,          // 字符、字符串、汉字、数字
+    LCD_STAT_PICTURE,       // 图片
+    LCD_STAT_FLUSH,         // lcd_flush发送显存
+    LCD_STAT_MAX,
+} lcd_stat_type_t;
+
+/***************************************************************
+* 名   称: lcd_stat_t
+* 说    明: 绘图统计；字节数等在提交给SPI时统计，
+*           启用异步发送时耗时不包括后台发送的时间
+***************************************************************/
+typedef struct
+{
+    uint32_t            calls;          // 绘图函数调用次数(嵌套调用只计最外层)
+    uint32_t            bytes;          // 发送的字节数
+    uint32_t            writes;         // IoTSpiWrite调用次数
+    uint32_t            windows;        // 地址窗口设置次数
+    uint32_t            ticks;          // 绘图函数耗时(tick)
+} lcd_stat_t;
+
 
 /***************************************************************
  * 函数名称: lcd_init
@@ -71,6 +145,56 @@ unsigned int lcd_init();
 unsigned int lcd_deinit();
 
 
+/***************************************************************
+ * 函数名称: lcd_sync
+ * 说    明: 等待之前的绘图数据全部发送到LCD；
+ *           启用异步发送时绘图函数在数据发出前就会返回
+ * 参    数: 无
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_sync(void);
+
+
+/***************************************************************
+ * 函数名称: lcd_stat_get
+ * 说    明: 获取某类绘图函数的累计统计
+ * 参    数:
+ *       @type：统计类别，见lcd_stat_type_t
+ *       @stat：返回统计数据
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_stat_get(uint8_t type, lcd_stat_t *stat);
+
+
+/***************************************************************
+ * 函数名称: lcd_stat_get_frame
+ * 说    明: 获取上一帧(两次lcd_flush之间)的统计
+ * 参    数:
+ *       @stat：返回统计数据
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_stat_get_frame(lcd_stat_t *stat);
+
+
+/***************************************************************
+ * 函数名称: lcd_stat_reset
+ * 说    明: 清零各类绘图函数的累计统计
+ * 参    数: 无
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_stat_reset(void);
+
+
+/***************************************************************
+ * 函数名称: lcd_stat_print
+ * 说    明: 用一行日志打印上一帧统计和各类绘图函数的累计统计
+ * 参    数:
+ *       @tag：日志前缀
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_stat_print(const char *tag);
+
+
 /***************************************************************
  * 函数名称: lcd_fill
  * 说    明: 指定区域填充颜色
@@ -85,6 +209,68 @@ unsigned int lcd_deinit();
 void lcd_fill(uint16_t xsta, uint16_t ysta, uint16_t xend, uint16_t yend, uint16_t color);
 
 
+/***************************************************************
+ * 函数名称: lcd_flush
+ * 说    明: 启用显存缓冲(lcd.c中LCD_ENABLE_FRAMEBUFFER为1)时，绘图函数
+ *           只写入显存，调用该函数后才把有变化的区块刷新到LCD；默认编译
+ *           不启用显存，绘图函数直接发送到LCD，该函数只结束一帧统计
+ * 参    数: 无
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_flush(void);
+
+
+/***************************************************************
+ * 函数名称: lcd_set_pixel_format
+ * 说    明: 设置之后发送到LCD的像素格式，绘图接口的颜色仍为RGB565；
+ *           RGB444每个像素少发送1/4的数据，颜色各分量只保留高4位，
+ *           适合纯色填充、文字和调色板图标，照片类图片应使用RGB565；
+ *           启用显存缓冲时按刷新时的格式发送，切换回RGB565时
+ *           以RGB444显示有偏差的区块会在下次刷新时重新发送
+ * 参    数:
+ *       @format：LCD_PIXEL_RGB565(默认)或LCD_PIXEL_RGB444
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_set_pixel_format(uint8_t format);
+
+
+/***************************************************************
+ * 函数名称: lcd_set_power
+ * 说    明: 设置显示状态。调低亮度使用0x51/0x53，只在背光接到
+ *           LCD的LEDPWM引脚时有效；休眠发送0x28、0x10，LCD停止扫描，
+ *           显存内容保留，唤醒后不需要重绘，只需等待5ms
+ * 参    数:
+ *       @mode：LCD_POWER_ON、LCD_POWER_DIM或LCD_POWER_SLEEP
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_set_power(uint8_t mode);
+
+
+/***************************************************************
+ * 函数名称: lcd_scroll_area
+ * 说    明: 设置硬件滚动区(0x33)，区外的内容固定不动；
+ *           滚动方向见LCD_SCROLL_VERTICAL，滚动区在另一方向上占满整个屏幕；
+ *           修改滚动区后需调用lcd_scroll_start重新设置起点
+ * 参    数:
+ *       @start：滚动区起始坐标(竖屏为Y坐标，横屏为X坐标)
+ *       @len：滚动区长度，lcd_scroll_area(0, LCD_SCROLL_LINES)恢复为不滚动
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_scroll_area(uint16_t start, uint16_t len);
+
+
+/***************************************************************
+ * 函数名称: lcd_scroll_start
+ * 说    明: 设置滚动起点(0x37)，滚动区起始处显示绘图坐标为start+offset的内容，
+ *           之后的内容依次循环显示；绘图坐标不受滚动影响；
+ *           启用显存缓冲时先发送有变化的区块，再移动起点
+ * 参    数:
+ *       @offset：相对滚动区起始处的偏移，0为不滚动
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_scroll_start(uint16_t offset);
+
+
 /***************************************************************
  * 函数名称: lcd_draw_point
  * 说    明: 指定位置画一个点
@@ -97,9 +283,35 @@ void lcd_fill(uint16_t xsta, uint16_t ysta, uint16_t xend, uint16_t yend, uint16
 void lcd_draw_point(uint16_t x, uint16_t y, uint16_t color);
 
 
+/***************************************************************
+ * 函数名称: lcd_draw_hline
+ * 说    明: 指定位置画一条水平线
+ * 参    数:
+ *       @x：指定线的起始点X坐标
+ *       @y：指定线的Y坐标
+ *       @len：指定线的长度
+ *       @color：指定线的颜色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_draw_hline(uint16_t x, uint16_t y, uint16_t len, uint16_t color);
+
+
+/***************************************************************
+ * 函数名称: lcd_draw_vline
+ * 说    明: 指定位置画一条垂直线
+ * 参    数:
+ *       @x：指定线的X坐标
+ *       @y：指定线的起始点Y坐标
+ *       @len：指定线的长度
+ *       @color：指定线的颜色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_draw_vline(uint16_t x, uint16_t y, uint16_t len, uint16_t color);
+
+
 /***************************************************************
  * 函数名称: lcd_draw_line
- * 说    明: 指定位置画一条线
+ * 说    明: 指定位置画一条线，水平线和垂直线自动使用快速画法
  * 参    数:
  *       @x1：指定线的起始点X坐标
  *       @y1：指定线的起始点Y坐标
@@ -125,6 +337,20 @@ void lcd_draw_line(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t
 void lcd_draw_rectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color);
 
 
+/***************************************************************
+ * 函数名称: lcd_fill_rectangle
+ * 说    明: 指定位置画实心矩形
+ * 参    数:
+ *       @x1：指定矩形的起始点X坐标
+ *       @y1：指定矩形的起始点Y坐标
+ *       @x2：指定矩形的结束点X坐标
+ *       @y2：指定矩形的结束点Y坐标
+ *       @color：指定矩形的颜色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_fill_rectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color);
+
+
 /***************************************************************
  * 函数名称: lcd_draw_circle
  * 说    明: 指定位置画圆
@@ -150,6 +376,79 @@ void lcd_draw_circle(uint16_t x0, uint16_t y0, uint8_t r, uint16_t color);
 void lcd_draw_triangle
 (uint16_t x0, uint16_t y0,uint16_t x1, uint16_t y1,uint16_t x2, uint16_t y2,  uint16_t color);
 
+
+/***************************************************************
+ * 函数名称: lcd_fill_circle
+ * 说    明: 指定位置画实心圆，逐行用水平线填充
+ * 参    数:
+ *       @x0：指定圆的中心点X坐标
+ *       @y0：指定圆的中心点Y坐标
+ *       @r：指定圆的半径
+ *       @color：指定圆的颜色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_fill_circle(uint16_t x0, uint16_t y0, uint8_t r, uint16_t color);
+
+
+/***************************************************************
+ * 函数名称: lcd_fill_triangle
+ * 说    明: 指定位置画实心三角形，逐行用水平线填充
+ * 参    数:
+ *       @x0,y0：第一个顶点坐标
+ *       @x1,y1：第二个顶点坐标
+ *       @x2,y2：第三个顶点坐标
+ *       @color：指定三角形的颜色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_fill_triangle(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color);
+
+
+/***************************************************************
+ * 函数名称: lcd_draw_round_rect
+ * 说    明: 指定位置画圆角矩形
+ * 参    数:
+ *       @x1：指定矩形的起始点X坐标
+ *       @y1：指定矩形的起始点Y坐标
+ *       @x2：指定矩形的结束点X坐标
+ *       @y2：指定矩形的结束点Y坐标
+ *       @r：圆角半径，超过宽高一半时按一半处理
+ *       @color：指定矩形的颜色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_draw_round_rect(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint8_t r, uint16_t color);
+
+
+/***************************************************************
+ * 函数名称: lcd_fill_round_rect
+ * 说    明: 指定位置画实心圆角矩形
+ * 参    数:
+ *       @x1：指定矩形的起始点X坐标
+ *       @y1：指定矩形的起始点Y坐标
+ *       @x2：指定矩形的结束点X坐标
+ *       @y2：指定矩形的结束点Y坐标
+ *       @r：圆角半径，超过宽高一半时按一半处理
+ *       @color：指定矩形的颜色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_fill_round_rect(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint8_t r, uint16_t color);
+
+
+/***************************************************************
+ * 函数名称: lcd_draw_arc
+ * 说    明: 画圆弧(圆环的一段)，可用于进度环
+ * 参    数:
+ *       @x0：指定圆的中心点X坐标
+ *       @y0：指定圆的中心点Y坐标
+ *       @r：外半径
+ *       @thickness：圆环宽度，为1时与lcd_draw_circle的轮廓一致
+ *       @start：起始角度，12点方向为0度，顺时针增加
+ *       @end：结束角度，end >= start + 360时画整个圆环
+ *       @color：指定圆弧的颜色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_draw_arc(uint16_t x0, uint16_t y0, uint8_t r, uint8_t thickness,
+    uint16_t start, uint16_t end, uint16_t color);
+
 /***************************************************************
  * 函数名称: lcd_show_chinese
  * 说    明: 显示汉字串
@@ -198,6 +497,46 @@ void lcd_show_char(uint16_t x, uint16_t y, uint8_t num, uint16_t fc, uint16_t bc
 void lcd_show_string(uint16_t x, uint16_t y, const uint8_t *p, uint16_t fc, uint16_t bc, uint8_t sizey, uint8_t mode);
 
 
+/***************************************************************
+ * 函数名称: lcd_show_text
+ * 说    明: 显示中英文混合字符串，超出屏幕宽度时自动换行
+ * 参    数:
+ *       @x：指定字符串的起始位置X坐标
+ *       @y：指定字符串的起始位置Y坐标
+ *       @str：指定字符串（该字符串为utf-8）
+ *       @fc: 字的颜色
+ *       @bc: 字的背景色
+ *       @font_size: 字号，可选：12、16、24、32
+ *       @mode: 0为非叠加模式；1为叠加模式
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_show_text(int x, int y, char *str, int fc, int bc, int font_size, int mode);
+
+
+/***************************************************************
+ * 函数名称: lcd_format_int
+ * 说    明: 按lcd_show_int_num的显示效果格式化整数，只用整数运算
+ * 参    数:
+ *       @buf：返回字符串，至少len+1字节
+ *       @num：整数，只取低len位
+ *       @len：位数，最多LCD_NUM_MAX位，高位的0显示为空格
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_format_int(char *buf, uint32_t num, uint8_t len);
+
+
+/***************************************************************
+ * 函数名称: lcd_format_fixed
+ * 说    明: 按lcd_show_float_num1的显示效果格式化两位小数，只用整数运算
+ * 参    数:
+ *       @buf：返回字符串，至少len+2字节
+ *       @num：放大100倍后的整数，只取低len位
+ *       @len：位数(不含小数点)，2~LCD_NUM_MAX位
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_format_fixed(char *buf, uint32_t num, uint8_t len);
+
+
 /***************************************************************
  * 函数名称: lcd_show_int_num
  * 说    明: 显示整数变量
@@ -242,5 +581,31 @@ void lcd_show_float_num1(uint16_t x, uint16_t y, float num, uint8_t len, uint16_
 void lcd_show_picture(uint16_t x, uint16_t y, uint16_t length, uint16_t width, const uint8_t *pic);
 
 
+/***************************************************************
+ * 函数名称: lcd_show_image
+ * 说    明: 显示Image2Lcd生成的图片，宽高从图片的文件头读取；
+ *           RGB565时像素数据直接从flash发送，不复制(使用显存时在
+ *           lcd_flush中发送)，因此图片须为一直有效的常量数组
+ * 参    数:
+ *       @x：指定图片的起始位置X坐标
+ *       @y：指定图片的起始位置Y坐标
+ *       @img：图片数组，包括8字节文件头
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_show_image(uint16_t x, uint16_t y, const uint8_t *img);
+
+
+/***************************************************************
+ * 函数名称: lcd_show_picture_compressed
+ * 说    明: 显示调色板+RLE压缩图片，边解码边发送
+ * 参    数:
+ *       @x：指定图片的起始位置X坐标
+ *       @y：指定图片的起始位置Y坐标
+ *       @pic：压缩图片
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_show_picture_compressed(uint16_t x, uint16_t y, const lcd_picture_rle_t *pic);
+
+
 
 #endif /* _LCD_H_ */
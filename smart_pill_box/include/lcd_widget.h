@@ -0,0 +1,290 @@
+/*
+ * Copyright (c) 2024 iSoftStone Education Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef _LCD_WIDGET_H_
+#define _LCD_WIDGET_H_
+
+#include <stdint.h>
+
+/* 控件类型 */
+typedef enum
+{
+    LCD_WIDGET_TYPE_LABEL = 0,      // 文本，支持中英文混合
+    LCD_WIDGET_TYPE_NUMBER,         // 整数
+    LCD_WIDGET_TYPE_FLOAT,          // 两位小数，value为放大100倍后的整数
+    LCD_WIDGET_TYPE_TIME,           // 时间，value为(时 << 8) | 分
+    LCD_WIDGET_TYPE_ICON,           // 图片(Image2Lcd格式，带文件头)
+    LCD_WIDGET_TYPE_LINE,           // 直线
+    LCD_WIDGET_TYPE_ICON_RLE,       // 压缩图片
+} lcd_widget_type_t;
+
+/***************************************************************
+* 名   称: lcd_widget_t
+* 说    明: 控件，记录控件位置、期望显示的内容以及上次绘制的内容，
+*           只有内容或颜色发生变化时才重新绘制
+***************************************************************/
+typedef struct
+{
+    uint8_t             type;           // 控件类型
+    uint8_t             sizey;          // 字号
+    uint8_t             len;            // 数字位数
+    uint16_t            x;              // 起始点X坐标
+    uint16_t            y;              // 起始点Y坐标
+    uint16_t            x1;             // 直线终点X坐标；时间控件冒号X坐标
+    uint16_t            y1;             // 直线终点Y坐标；时间控件分钟X坐标
+    const void         *data;           // 文本或图片内容
+    uint8_t             fixed;          // 1为固定内容(不调用lcd_widget_set)，可预先画进页面背景
+
+    /* 期望显示的内容，由调用者通过lcd_widget_set设置 */
+    int32_t             value;
+    uint16_t            fc;
+    uint16_t            bc;
+
+    /* 上次绘制的内容，由控件层维护 */
+    uint8_t             drawn;
+    int32_t             drawn_value;
+    uint16_t            drawn_fc;
+    uint16_t            drawn_bc;
+    const void         *drawn_data;
+} lcd_widget_t;
+
+/* 控件定义辅助宏 */
+#define LCD_WIDGET_LABEL(_x, _y, _text, _fc, _bc, _sizey) \
+    { .type = LCD_WIDGET_TYPE_LABEL, .x = (_x), .y = (_y), .data = (_text), \
+      .fc = (_fc), .bc = (_bc), .sizey = (_sizey) }
+
+#define LCD_WIDGET_NUMBER(_x, _y, _len, _fc, _bc, _sizey) \
+    { .type = LCD_WIDGET_TYPE_NUMBER, .x = (_x), .y = (_y), .len = (_len), \
+      .fc = (_fc), .bc = (_bc), .sizey = (_sizey) }
+
+#define LCD_WIDGET_FLOAT(_x, _y, _len, _fc, _bc, _sizey) \
+    { .type = LCD_WIDGET_TYPE_FLOAT, .x = (_x), .y = (_y), .len = (_len), \
+      .fc = (_fc), .bc = (_bc), .sizey = (_sizey) }
+
+#define LCD_WIDGET_TIME(_x, _colon_x, _min_x, _y, _len, _fc, _bc, _sizey) \
+    { .type = LCD_WIDGET_TYPE_TIME, .x = (_x), .x1 = (_colon_x), .y1 = (_min_x), \
+      .y = (_y), .len = (_len), .fc = (_fc), .bc = (_bc), .sizey = (_sizey) }
+
+#define LCD_WIDGET_ICON(_x, _y, _pic) \
+    { .type = LCD_WIDGET_TYPE_ICON, .x = (_x), .y = (_y), .data = (_pic) }
+
+#define LCD_WIDGET_ICON_RLE(_x, _y, _pic) \
+    { .type = LCD_WIDGET_TYPE_ICON_RLE, .x = (_x), .y = (_y), .data = (_pic) }
+
+#define LCD_WIDGET_LINE(_x1, _y1, _x2, _y2, _color) \
+    { .type = LCD_WIDGET_TYPE_LINE, .x = (_x1), .y = (_y1), .x1 = (_x2), \
+      .y1 = (_y2), .fc = (_color) }
+
+/* 固定内容的控件，属于页面背景 */
+#define LCD_WIDGET_FIXED_LABEL(_x, _y, _text, _fc, _bc, _sizey) \
+    { .type = LCD_WIDGET_TYPE_LABEL, .x = (_x), .y = (_y), .data = (_text), \
+      .fc = (_fc), .bc = (_bc), .sizey = (_sizey), .fixed = 1 }
+
+#define LCD_WIDGET_FIXED_ICON_RLE(_x, _y, _pic) \
+    { .type = LCD_WIDGET_TYPE_ICON_RLE, .x = (_x), .y = (_y), .data = (_pic), .fixed = 1 }
+
+#define LCD_WIDGET_FIXED_LINE(_x1, _y1, _x2, _y2, _color) \
+    { .type = LCD_WIDGET_TYPE_LINE, .x = (_x1), .y = (_y1), .x1 = (_x2), \
+      .y1 = (_y2), .fc = (_color), .fixed = 1 }
+
+/* 滚动文本控件每行最多保存的字节数(含结束符) */
+#define LCD_CONSOLE_LINE_MAX    48
+
+/***************************************************************
+* 名   称: lcd_console_t
+* 说    明: 滚动文本控件，新行加在最下方，旧行向上滚出；
+*           每行固定显示在区域中的某一行位置，增加一行只重绘这一行：
+*           竖屏时用LCD硬件滚动把最旧的一行移到区域顶部，
+*           横屏时硬件滚动方向与文本行方向垂直，各行循环覆盖，
+*           并在最新一行左侧显示'>'标记
+***************************************************************/
+typedef struct
+{
+    uint16_t            x;              // 起始点X坐标(竖屏时滚动区占满整行，应为0)
+    uint16_t            y;              // 起始点Y坐标
+    uint16_t            width;          // 区域宽度
+    uint8_t             lines;          // 显示行数
+    uint8_t             sizey;          // 字号
+    uint16_t            fc;             // 前景色
+    uint16_t            bc;             // 背景色
+    char              (*text)[LCD_CONSOLE_LINE_MAX];   // 文本缓存，共lines行
+
+    /* 由控件层维护 */
+    uint32_t            total;          // 已添加的行数
+    uint32_t            drawn;          // 已绘制的行数
+    uint8_t             shown;          // 是否已显示
+} lcd_console_t;
+
+#define LCD_CONSOLE(_x, _y, _width, _lines, _fc, _bc, _sizey, _text) \
+    { .x = (_x), .y = (_y), .width = (_width), .lines = (_lines), \
+      .fc = (_fc), .bc = (_bc), .sizey = (_sizey), .text = (_text) }
+
+/***************************************************************
+* 名   称: lcd_chart_t
+* 说    明: 曲线图控件，每个采样显示为一列，与前一个采样连成竖线；
+*           第n个采样固定显示在第n % width列，写到最右边后回到左边
+*           循环覆盖，其右侧一列清空作为最新位置的间隔，
+*           增加一个采样只重绘两列。LCD硬件滚动只能整行(竖屏)或
+*           整列(横屏)滚动，不能只滚动屏幕中的一块区域，因此不使用
+***************************************************************/
+typedef struct
+{
+    uint16_t            x;              // 起始点X坐标
+    uint16_t            y;              // 起始点Y坐标
+    uint16_t            width;          // 区域宽度，最多显示width - 1个采样
+    uint8_t             height;         // 区域高度
+    int32_t             min;            // 区域底部对应的采样值
+    int32_t             max;            // 区域顶部对应的采样值，超出范围的采样显示在边缘
+    uint16_t            fc;             // 曲线颜色
+    uint16_t            bc;             // 背景色
+    uint8_t            *data;           // 采样缓存，共width个，保存采样在区域中的高度
+
+    /* 由控件层维护 */
+    uint32_t            total;          // 已添加的采样数
+    uint32_t            drawn;          // 已绘制的采样数
+    uint8_t             shown;          // 是否已显示
+} lcd_chart_t;
+
+#define LCD_CHART(_x, _y, _width, _height, _min, _max, _fc, _bc, _data) \
+    { .x = (_x), .y = (_y), .width = (_width), .height = (_height), \
+      .min = (_min), .max = (_max), .fc = (_fc), .bc = (_bc), .data = (_data) }
+
+
+/***************************************************************
+ * 函数名称: lcd_widget_set
+ * 说    明: 设置控件期望显示的内容和颜色
+ * 参    数:
+ *       @w：控件
+ *       @value：数值(文本、图片和直线控件忽略该值)
+ *       @fc: 前景色
+ *       @bc: 背景色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_widget_set(lcd_widget_t *w, int32_t value, uint16_t fc, uint16_t bc);
+
+
+/***************************************************************
+ * 函数名称: lcd_widget_invalidate
+ * 说    明: 标记一组控件需要重新绘制(如清屏或切换页面后)
+ * 参    数:
+ *       @w：控件数组
+ *       @count：控件个数
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_widget_invalidate(lcd_widget_t *w, uint16_t count);
+
+
+/***************************************************************
+ * 函数名称: lcd_widget_draw_fixed
+ * 说    明: 绘制一组控件中的固定控件(页面背景)，其余控件标记为需要重绘
+ * 参    数:
+ *       @w：控件数组
+ *       @count：控件个数
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_widget_draw_fixed(lcd_widget_t *w, uint16_t count);
+
+
+/***************************************************************
+ * 函数名称: lcd_widget_skip_fixed
+ * 说    明: 固定控件已包含在显示的页面背景图中，标记为已绘制，
+ *           其余控件标记为需要重绘
+ * 参    数:
+ *       @w：控件数组
+ *       @count：控件个数
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_widget_skip_fixed(lcd_widget_t *w, uint16_t count);
+
+
+/***************************************************************
+ * 函数名称: lcd_widget_render
+ * 说    明: 按顺序绘制一组控件中内容或颜色有变化的控件；
+ *           某个控件重绘后，与其区域重叠的后续控件也会重绘，
+ *           保证叠放顺序与全部重绘时一致
+ * 参    数:
+ *       @w：控件数组
+ *       @count：控件个数
+ * 返 回 值: 本次重绘的控件个数
+ ***************************************************************/
+uint16_t lcd_widget_render(lcd_widget_t *w, uint16_t count);
+
+
+/***************************************************************
+ * 函数名称: lcd_console_add
+ * 说    明: 在滚动文本控件末尾增加一行，只保存文本，
+ *           下次调用lcd_console_render时绘制
+ * 参    数:
+ *       @c：控件
+ *       @text：文本(utf-8)，超出宽度的部分不显示
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_console_add(lcd_console_t *c, const char *text);
+
+
+/***************************************************************
+ * 函数名称: lcd_console_render
+ * 说    明: 绘制滚动文本控件；首次显示时绘制全部行，
+ *           之后只绘制新增的行并移动滚动起点
+ * 参    数:
+ *       @c：控件
+ * 返 回 值: 本次绘制的行数
+ ***************************************************************/
+uint16_t lcd_console_render(lcd_console_t *c);
+
+
+/***************************************************************
+ * 函数名称: lcd_console_hide
+ * 说    明: 切换到其他页面前调用，恢复LCD滚动设置，
+ *           下次lcd_console_render时重新绘制全部行
+ * 参    数:
+ *       @c：控件
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_console_hide(lcd_console_t *c);
+
+
+/***************************************************************
+ * 函数名称: lcd_chart_add
+ * 说    明: 在曲线图控件末尾增加一个采样，只保存数据，
+ *           下次调用lcd_chart_render时绘制
+ * 参    数:
+ *       @c：控件
+ *       @value：采样值，与min、max的单位相同
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_chart_add(lcd_chart_t *c, int32_t value);
+
+
+/***************************************************************
+ * 函数名称: lcd_chart_render
+ * 说    明: 绘制曲线图控件；首次显示时绘制全部采样，
+ *           之后只绘制新增的采样列和其右侧的间隔列
+ * 参    数:
+ *       @c：控件
+ * 返 回 值: 本次绘制的采样个数
+ ***************************************************************/
+uint16_t lcd_chart_render(lcd_chart_t *c);
+
+
+/***************************************************************
+ * 函数名称: lcd_chart_hide
+ * 说    明: 切换到其他页面前调用，下次lcd_chart_render时重新绘制全部采样
+ * 参    数:
+ *       @c：控件
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_chart_hide(lcd_chart_t *c);
+
+#endif /* _LCD_WIDGET_H_ */
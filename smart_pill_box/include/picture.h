@@ -14,8 +14,24 @@
  */
 #ifndef _PICTURE_H_
 #define _PICTURE_H_
+
+#include "lcd.h"
+
+/* 原始图片，只编译进主机模拟器(用于lcd_show_image)，固件中使用下面的压缩图片 */
 extern const unsigned char Light_picture[];
 extern const unsigned char humidity_picture[8200];
 extern const unsigned char temperature_picture[6536];
 extern const unsigned char gas_picture[8200];
+
+/* 压缩图片，编译时由tools/picture_rle.py根据picture.c生成 */
+extern const lcd_picture_rle_t Light_picture_rle;
+extern const lcd_picture_rle_t humidity_picture_rle;
+extern const lcd_picture_rle_t temperature_picture_rle;
+extern const lcd_picture_rle_t gas_picture_rle;
+
+/* 页面背景(固定控件)，由host目录中make page_bg生成src/page_bg.c */
+extern const lcd_picture_rle_t page0_bg_rle;
+extern const lcd_picture_rle_t page1_bg_rle;
+extern const lcd_picture_rle_t page2_bg_rle;
+extern const lcd_picture_rle_t page3_bg_rle;
 #endif
\ No newline at end of file
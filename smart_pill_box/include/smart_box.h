@@ -4,8 +4,46 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+/***************************************************************
+* 名   称: smart_box_ui_t
+* 说    明: 界面显示所需的数据
+***************************************************************/
+typedef struct
+{
+    uint8_t             display;            // 当前页面，0药盒数量，1环境数据，2设置，3记录
+    uint8_t             dis2;               // 设置页面中选中的项
+    uint8_t             eat_index;          // 下一次吃药的序号
+    uint8_t             hour;               // 当前时
+    uint8_t             min;                // 当前分
+    float               lum;                // 光照
+    float               humi;               // 湿度
+    float               temp;               // 温度
+    float               gas;                // 烟雾浓度
+    unsigned int        storage_time[3];    // 药品存储时间
+    unsigned char       eat_1[3];           // 一号药盒每次吃药数量
+    unsigned char       eat_2[3];           // 二号药盒每次吃药数量
+    unsigned char       eat_3[3];           // 三号药盒每次吃药数量
+    unsigned char       eat_time[3][2];     // 三次吃药时间(时，分)
+    uint8_t             power;              // 显示状态LCD_POWER_xxx，休眠时不绘制
+} smart_box_ui_t;
+
+/* 页面个数 */
+#define SMART_BOX_PAGE_NUM      4
+
+/* 环境数据曲线显示的采样个数及采样周期(秒)，共显示24小时 */
+#define SMART_BOX_CHART_SAMPLES 63
+#define SMART_BOX_CHART_PERIOD  (24 * 60 * 60 / SMART_BOX_CHART_SAMPLES)
 
 void lcd_dev_init(void);
-void lcd_show_ui(void);
+void lcd_show_background(uint8_t display, uint8_t use_bg);
+void lcd_show_ui(const smart_box_ui_t *ui);
+void lcd_add_history(const char *text);
+void lcd_add_sensor(float lum, float humi, float temp, float gas);
+
+/* 显示任务，绘制不在调用者的任务中进行 */
+unsigned int smart_box_display_init(void);
+void smart_box_display_show(const smart_box_ui_t *ui);
+void smart_box_display_history(const char *text);
+void smart_box_display_sensor(float lum, float humi, float temp, float gas);
 
 #endif
@@ -14,6 +14,7 @@
  */
 
 #include <stdio.h>
+#include <stdarg.h>
 #include <stdbool.h>
 
 #include "drv_steering.h"
@@ -26,6 +27,7 @@
 #include "su_03t.h"
 #include "iot.h"
 #include "lcd.h"
+#include "lcd_widget.h"
 #include "picture.h"
 #include "adc_key.h"
 #include "drv_sensors.h"
@@ -58,7 +60,25 @@
 #define LOG_SC_TAG_NTP             "["LOG_SC_TAG" ntp       %4d] "
 #define LOG_SC_TAG_KEY             "["LOG_SC_TAG" key       %4d] "
 #define LOG_SC_TAG_ALARM           "["LOG_SC_TAG" alarm     %4d] "
-#define LOG_SC_TAG_DISPLAY         "["LOG_SC_TAG" display   %4d] "
+
+/* 显示刷新状态：有人、有操作或数据变化较快时为活跃，快速读取传感器并刷新；
+ * 一段时间没有活动后进入慢速，只降低读取传感器和刷新的频率，显示不变
+ * (开发板背光没有接到LCD的LEDPWM引脚，不能调低亮度)；再过一段时间进入休眠，
+ * LCD关闭显示。按键、人体感应随时唤醒 */
+#define GOV_ACTIVE                 0
+#define GOV_SLOW                   1
+#define GOV_SLEEP                  2
+#define GOV_POLL_MS                200         // 按键事件和人体感应的检查周期
+#define GOV_SLOW_MS                30000       // 没有活动多久后进入慢速
+#define GOV_SLEEP_MS               300000      // 没有活动多久后进入休眠
+#define GOV_IOT_MS                 3000        // 上报iot数据的周期，与显示状态无关
+/* 每秒变化超过以下值时视为有活动 */
+#define GOV_RATE_LUM               10.0
+#define GOV_RATE_HUMI              1.0
+#define GOV_RATE_TEMP              0.2
+#define GOV_RATE_GAS               2.0
+
+#define GOV_MS2TICK(ms)            ((uint64_t)(ms) * LOSCFG_BASE_CORE_TICK_PER_SECOND / 1000)
 
 /***************************************************************
 * 名   称: sc_ntp_time_t
@@ -300,6 +320,31 @@ unsigned char eat_3[3]={3,4,5};
 unsigned char eat_time[3][2]={8,30,12,10,18,30};
 unsigned char eat_index=0;
 
+/***************************************************************
+ * 函数名称: smart_box_history
+ * 说    明: 增加一条带时间的吃药或报警记录，在记录页面显示
+ * 参    数:
+ *       @fmt：格式，同printf
+ * 返 回 值: 无
+ ***************************************************************/
+static void smart_box_history(const char *fmt, ...)
+{
+    char text[LCD_CONSOLE_LINE_MAX];
+    int len = 0;
+    va_list args;
+
+    if (now_tm != NULL)
+    {
+        len = snprintf(text, sizeof(text), "%02d:%02d ", now_tm->tm_hour, now_tm->tm_min);
+    }
+    va_start(args, fmt);
+    vsnprintf(text + len, sizeof(text) - len, fmt, args);
+    va_end(args);
+
+    printf(LOG_SC_TAG_ALARM"%s\n", __LINE__, text);
+    smart_box_display_history(text);
+}
+
 void smart_home_key_process(uint8_t key_no)
 {
     switch(key_no)
@@ -309,10 +354,8 @@ void smart_home_key_process(uint8_t key_no)
             steering_state=false;
             steering_set_state(steering_state);
         }
-        if((display==2&&dis2==0)||display==0||display==1) {
-            display=(display+1)%3;
-        
-             lcd_fill(0,0,320,240,LCD_WHITE);
+        if((display==2&&dis2==0)||display==0||display==1||display==3) {
+            display=(display+1)%4;
         }
         
         if(display==2) {
@@ -388,6 +431,7 @@ void smart_home_key_process(uint8_t key_no)
             come_eat=false;
             steering_state=false;
             steering_set_state(steering_state);
+            smart_box_history("dose %d taken (key)", eat_index + 1);
             
             if(++eat_index==3) eat_index=0;
         }
@@ -436,6 +480,7 @@ void smart_home_su03t_cmd_process(int su03t_cmd)
             come_eat=false;
             steering_state=false;
             steering_set_state(steering_state);
+            smart_box_history("dose %d taken (voice)", eat_index + 1);
             
             if(++eat_index==3) eat_index=0;
             su03t_send_uchar_msg(2, time1); 
@@ -449,6 +494,85 @@ void smart_home_su03t_cmd_process(int su03t_cmd)
 }
 
 
+/* 各显示状态读取传感器的周期和LCD显示状态；慢速时不使用LCD_POWER_DIM，见GOV_SLOW */
+static const uint32_t m_gov_period_ms[] = {500, 3000, 3000};
+static const uint8_t m_gov_power[] = {LCD_POWER_ON, LCD_POWER_ON, LCD_POWER_SLEEP};
+static uint8_t  m_gov_state = GOV_ACTIVE;
+static uint64_t m_gov_active_tick = 0;
+
+/***************************************************************
+ * 函数名称: smart_box_gov_wake
+ * 说    明: 记录一次活动，切换到活跃状态
+ * 参    数: 无
+ * 返 回 值: 1为状态有变化，需立即更新界面；0为原来就是活跃状态
+ ***************************************************************/
+static int smart_box_gov_wake(void)
+{
+    m_gov_active_tick = LOS_TickCountGet();
+    if (m_gov_state == GOV_ACTIVE)
+    {
+        return 0;
+    }
+    printf("governor active\n");
+    m_gov_state = GOV_ACTIVE;
+    return 1;
+}
+
+
+/***************************************************************
+ * 函数名称: smart_box_gov_update
+ * 说    明: 按最近一次活动到现在的时间切换慢速、休眠状态
+ * 参    数: 无
+ * 返 回 值: 无
+ ***************************************************************/
+static void smart_box_gov_update(void)
+{
+    uint64_t idle = LOS_TickCountGet() - m_gov_active_tick;
+    uint8_t state = GOV_ACTIVE;
+
+    if (idle >= GOV_MS2TICK(GOV_SLEEP_MS))
+    {
+        state = GOV_SLEEP;
+    }
+    else if (idle >= GOV_MS2TICK(GOV_SLOW_MS))
+    {
+        state = GOV_SLOW;
+    }
+    if (state != m_gov_state)
+    {
+        printf("governor %s\n", (state == GOV_SLEEP) ? "sleep, display off" : "slow, sensor polling reduced");
+        m_gov_state = state;
+    }
+}
+
+
+/***************************************************************
+ * 函数名称: smart_box_post_ui
+ * 说    明: 把当前状态提交给显示任务，传感器数据使用ui中最近一次读取的值
+ * 参    数:
+ *       @ui：界面数据
+ * 返 回 值: 无
+ ***************************************************************/
+static void smart_box_post_ui(smart_box_ui_t *ui)
+{
+    ui->display = display;
+    ui->dis2 = dis2;
+    ui->eat_index = eat_index;
+    if (now_tm != NULL)
+    {
+        ui->hour = now_tm->tm_hour;
+        ui->min = now_tm->tm_min;
+    }
+    memcpy(ui->storage_time, storage_time, sizeof(ui->storage_time));
+    memcpy(ui->eat_1, eat_1, sizeof(ui->eat_1));
+    memcpy(ui->eat_2, eat_2, sizeof(ui->eat_2));
+    memcpy(ui->eat_3, eat_3, sizeof(ui->eat_3));
+    memcpy(ui->eat_time, eat_time, sizeof(ui->eat_time));
+    ui->power = m_gov_power[m_gov_state];
+    smart_box_display_show(ui);
+}
+
+
 /***************************************************************
  * 函数名称: smart_box_thread
  * 说    明: 智慧药盒主线程
@@ -463,16 +587,32 @@ void smart_box_thread(void *arg)
     double humidity_range = 80.0;
 
     e_iot_data iot_data = {0};
+    smart_box_ui_t ui = {0};
+    int ui_valid = 0;
+    /* 环境数据曲线：每SMART_BOX_CHART_PERIOD秒提交一次这段时间内的平均值，
+     * 起始时间向前推一个周期，第一次读取后立即提交 */
+    uint64_t chart_period = (uint64_t)SMART_BOX_CHART_PERIOD * LOSCFG_BASE_CORE_TICK_PER_SECOND;
+    uint64_t chart_tick = LOS_TickCountGet() - chart_period;
+    double chart_sum[4] = {0};
+    uint32_t chart_count = 0;
+    /* 上次读取传感器和上报iot数据的时间，起始时间向前推，第一次循环立即读取 */
+    uint64_t read_tick = LOS_TickCountGet() - GOV_MS2TICK(GOV_SLEEP_MS);
+    uint64_t iot_tick = read_tick;
+    uint64_t now;
+    double last[4] = {0};
+    double dt;
+    bool body;
 
     mq2_init();
     i2c_dev_init();
-    lcd_dev_init();
+    smart_box_display_init();
     light_dev_init();
     su03t_init();
     
     beep_dev_init();
     body_induction_dev_init();
     steering_dev_init();
+    smart_box_gov_wake();
     //lcd_show_ui();
      
    //key:
@@ -481,13 +621,20 @@ void smart_box_thread(void *arg)
    
         event_info_t event_info = {0};
         //等待事件触发,如有触发,则立即处理对应事件,如未等到,则执行默认的代码逻辑,更新屏幕
-        int ret = smart_home_event_wait(&event_info,3000);
+        int ret = smart_home_event_wait(&event_info, GOV_POLL_MS);
         if(ret == LOS_OK){
             //收到指令
             printf("event recv %d ,%d\n",event_info.event,event_info.data.iot_data);
             switch (event_info.event)
             {
                 case event_key_press:
+                    /* 休眠时屏幕熄灭，用户看不到当前页面，这次按键只用于
+                     * 唤醒显示，不修改药量、舵机等设置；慢速时显示不变，正常处理 */
+                    if (m_gov_state == GOV_SLEEP)
+                    {
+                        printf("key %d: wake display only\n", event_info.data.key_no);
+                        break;
+                    }
                     smart_home_key_process(event_info.data.key_no);
                     
                      //goto key;
@@ -500,23 +647,48 @@ void smart_box_thread(void *arg)
                     break;
                default:break;
             }
-            
+            /* 按键等操作立即更新界面，不等待下面读取传感器；
+             * 设置页面移动选中项时只重绘原选中项和新选中项 */
+            smart_box_gov_wake();
+            if (ui_valid)
+            {
+                smart_box_post_ui(&ui);
+            }
+        }
+
+        /* 有人时立即唤醒显示，休眠期间显示内容保留，唤醒后只绘制变化 */
+        body_induction_get_state(&body);
+        if (body && smart_box_gov_wake() && ui_valid)
+        {
+            smart_box_post_ui(&ui);
         }
 
+        /* 按当前显示状态的周期读取传感器 */
+        now = LOS_TickCountGet();
+        if (now - read_tick < GOV_MS2TICK(m_gov_period_ms[m_gov_state]))
+        {
+            continue;
+        }
+        dt = (double)(now - read_tick) / LOSCFG_BASE_CORE_TICK_PER_SECOND;
+        read_tick = now;
+
         double temp,humi,lum;
         float gas;
-        short accelerated[3];
-        bool body;
+        short accelerated[3] = {0};
+        bool acc_ok;
         sht30_read_data(&temp,&humi);
         bh1750_read_data(&lum);
-        mpu6050_read_data(accelerated);
+        /* 加速度读取失败时不判断倾倒 */
+        acc_ok = (mpu6050_read_data(accelerated) == IOT_SUCCESS);
          
         mq2_read_data(&gas);
         
-        body_induction_get_state(&body);
         printf("温度:%.2lf\n湿度:%.2lf\n光照:%.2lf\n加速度:%hd,,%hd,,%hd\nmq2:%.2lf\n人体:%d\n",temp,humi,lum,accelerated[0],accelerated[1],accelerated[2],gas,body);
         
-        if(temp>50|humi>80|lum>150|accelerated[2]<1800|gas>50){
+        if(temp>50|humi>80|lum>150|(acc_ok&&accelerated[2]<1800)|gas>50){
+            if(!light_state){
+                smart_box_history("env alarm T%.1f H%.1f G%.1f", temp, humi, gas);
+            }
             light_state=true;
         }
         else{
@@ -525,6 +697,9 @@ void smart_box_thread(void *arg)
         light_set_state(light_state);
         
         if(come_eat==false&&now_tm->tm_hour==eat_time[eat_index][0]&&now_tm->tm_min==eat_time[eat_index][1]){
+            if(!beep_state){
+                smart_box_history("dose %d alarm", eat_index + 1);
+            }
             beep_state=true;
             beep_set_state(beep_state);
         }
@@ -535,6 +710,7 @@ void smart_box_thread(void *arg)
             come_eat=true;
             steering_state=true;
             steering_set_state(steering_state);
+            smart_box_history("dose %d box open", eat_index + 1);
         }
 
 
@@ -547,8 +723,9 @@ void smart_box_thread(void *arg)
 
 
 
-        if (mqtt_is_connected()) 
+        if (mqtt_is_connected() && (now - iot_tick >= GOV_MS2TICK(GOV_IOT_MS)))
         {
+            iot_tick = now;
             //发送iot数据
             iot_data.illumination = lum;
             iot_data.temperature = temp;
@@ -561,122 +738,45 @@ void smart_box_thread(void *arg)
            
         }        
         
-        switch(display)
+        chart_sum[0] += lum;
+        chart_sum[1] += humi;
+        chart_sum[2] += temp;
+        chart_sum[3] += gas;
+        chart_count++;
+        if (LOS_TickCountGet() - chart_tick >= chart_period)
         {
-            case 0:
-            lcd_draw_line(107,0,107,200,LCD_BLACK);
-            lcd_draw_line(214,0,214,200,LCD_BLACK);
-            lcd_draw_line(0,100,320,100,LCD_BLACK);
-            lcd_draw_line(0,200,320,200,LCD_BLACK);
-            
-            lcd_show_chinese(1,1,"一号药盒",LCD_DARKBLUE,LCD_WHITE,24,0);
-            lcd_show_chinese(108,1,"二号药盒",LCD_DARKBLUE,LCD_WHITE,24,0);
-            lcd_show_chinese(215,1,"三号药盒",LCD_DARKBLUE,LCD_WHITE,24,0);
-
-            lcd_show_int_num(5,105,eat_1[eat_index],3,LCD_DARKBLUE,LCD_WHITE,32);
-            lcd_show_int_num(112,105,eat_2[eat_index],3,LCD_DARKBLUE,LCD_WHITE,32);
-            lcd_show_int_num(219,105,eat_3[eat_index],3,LCD_DARKBLUE,LCD_WHITE,32);
-
-            lcd_show_string(0,210,"Next Time:",LCD_BROWN,LCD_WHITE,32,0);
-            lcd_show_int_num(170,210,eat_time[eat_index][0],3,LCD_DARKBLUE,LCD_WHITE,32);
-            lcd_show_string(230,210,":",LCD_DARKBLUE,LCD_WHITE,32,0);
-            lcd_show_int_num(250,210,eat_time[eat_index][1],3,LCD_DARKBLUE,LCD_WHITE,32);
-
-
-            break;
-            case 1:
-            
-         lcd_show_picture(0,0,64,64,Light_picture);
-        lcd_show_float_num1(0,84,lum,5,LCD_DARKBLUE,LCD_WHITE,24);
-        lcd_show_picture(84,0,64,64,humidity_picture);
-        lcd_show_float_num1(84,84,humi,4,LCD_DARKBLUE,LCD_WHITE,24);
-        lcd_show_picture(168,0,51,64,temperature_picture);
-        lcd_show_float_num1(168,84,temp,4,LCD_DARKBLUE,LCD_WHITE,24);
-        lcd_show_picture(252,0,64,64,gas_picture);
-        lcd_show_float_num1(252,84,gas,4,LCD_DARKBLUE,LCD_WHITE,24);
-
-        lcd_show_string(0,140,"Time:",LCD_BROWN,LCD_WHITE,32,0);
-        lcd_show_int_num(150,140,now_tm->tm_hour,2,LCD_DARKBLUE,LCD_WHITE,32);
-        lcd_show_string(215,140,":",LCD_DARKBLUE,LCD_WHITE,32,0);
-        lcd_show_int_num(248,140,now_tm->tm_min,2,LCD_DARKBLUE,LCD_WHITE,32);
-            
-            break;
-            case 2:
-            lcd_draw_line(50,0,50,240,LCD_BLACK);
-            lcd_draw_line(140,0,140,240,LCD_BLACK);
-            lcd_draw_line(230,0,230,240,LCD_BLACK);
-            
-            lcd_show_string(0,0,"button",LCD_DARKBLUE,dis2==0? LCD_GRAY:LCD_WHITE,16,0);
-
-            lcd_show_int_num(51,69,storage_time[0],4,LCD_DARKBLUE,dis2==1? LCD_GRAY:LCD_WHITE,32);
-            lcd_show_int_num(51,139,storage_time[1],4,LCD_DARKBLUE,dis2==2? LCD_GRAY:LCD_WHITE,32);
-            lcd_show_int_num(51,209,storage_time[2],4,LCD_DARKBLUE,dis2==3? LCD_GRAY:LCD_WHITE,32);
-
-            lcd_show_int_num(141,31,eat_time[0][0],3,LCD_DARKBLUE,dis2==4? LCD_GRAY:LCD_WHITE,16);
-            lcd_show_string(173,31,":",LCD_DARKBLUE,LCD_WHITE,16,0);
-            lcd_show_int_num(190,31,eat_time[0][1],3,LCD_DARKBLUE,dis2==5? LCD_GRAY:LCD_WHITE,16);
-            lcd_show_int_num(141,101,eat_time[0][0],3,LCD_DARKBLUE,dis2==4? LCD_GRAY:LCD_WHITE,16);
-            lcd_show_string(173,101,":",LCD_DARKBLUE,LCD_WHITE,16,0);
-            lcd_show_int_num(190,101,eat_time[0][1],3,LCD_DARKBLUE,dis2==5? LCD_GRAY:LCD_WHITE,16);
-            lcd_show_int_num(141,171,eat_time[0][0],3,LCD_DARKBLUE,dis2==4? LCD_GRAY:LCD_WHITE,16);
-            lcd_show_string(173,171,":",LCD_DARKBLUE,LCD_WHITE,16,0);
-            lcd_show_int_num(190,171,eat_time[0][1],3,LCD_DARKBLUE,dis2==5? LCD_GRAY:LCD_WHITE,16);
-
-            lcd_show_int_num(141,54,eat_time[1][0],3,LCD_DARKBLUE,dis2==6? LCD_GRAY:LCD_WHITE,16);
-            lcd_show_string(173,54,":",LCD_DARKBLUE,LCD_WHITE,16,0);
-            lcd_show_int_num(190,54,eat_time[1][1],3,LCD_DARKBLUE,dis2==7? LCD_GRAY:LCD_WHITE,16);
-             lcd_show_int_num(141,124,eat_time[1][0],3,LCD_DARKBLUE,dis2==6? LCD_GRAY:LCD_WHITE,16);
-            lcd_show_string(173,124,":",LCD_DARKBLUE,LCD_WHITE,16,0);
-            lcd_show_int_num(190,124,eat_time[1][1],3,LCD_DARKBLUE,dis2==7? LCD_GRAY:LCD_WHITE,16);
-             lcd_show_int_num(141,194,eat_time[1][0],3,LCD_DARKBLUE,dis2==6? LCD_GRAY:LCD_WHITE,16);
-            lcd_show_string(173,194,":",LCD_DARKBLUE,LCD_WHITE,16,0);
-            lcd_show_int_num(190,194,eat_time[1][1],3,LCD_DARKBLUE,dis2==7? LCD_GRAY:LCD_WHITE,16);
-
-            lcd_show_int_num(141,78,eat_time[2][0],3,LCD_DARKBLUE,dis2==8? LCD_GRAY:LCD_WHITE,16);
-            lcd_show_string(173,78,":",LCD_DARKBLUE,LCD_WHITE,16,0);
-            lcd_show_int_num(190,78,eat_time[2][1],3,LCD_DARKBLUE,dis2==9? LCD_GRAY:LCD_WHITE,16);
-            lcd_show_int_num(141,148,eat_time[2][0],3,LCD_DARKBLUE,dis2==8? LCD_GRAY:LCD_WHITE,16);
-            lcd_show_string(173,148,":",LCD_DARKBLUE,LCD_WHITE,16,0);
-            lcd_show_int_num(190,148,eat_time[2][1],3,LCD_DARKBLUE,dis2==9? LCD_GRAY:LCD_WHITE,16);
-            lcd_show_int_num(141,218,eat_time[2][0],3,LCD_DARKBLUE,dis2==8? LCD_GRAY:LCD_WHITE,16);
-            lcd_show_string(173,218,":",LCD_DARKBLUE,LCD_WHITE,16,0);
-            lcd_show_int_num(190,218,eat_time[2][1],3,LCD_DARKBLUE,dis2==9? LCD_GRAY:LCD_WHITE,16);
-
-            lcd_show_int_num(240,31,eat_1[0],3,LCD_DARKBLUE,dis2==10? LCD_GRAY:LCD_WHITE,16);
-            lcd_show_int_num(240,54,eat_1[1],3,LCD_DARKBLUE,dis2==11? LCD_GRAY:LCD_WHITE,16);
-            lcd_show_int_num(240,78,eat_1[2],3,LCD_DARKBLUE,dis2==12? LCD_GRAY:LCD_WHITE,16);
-            lcd_show_int_num(240,101,eat_2[0],3,LCD_DARKBLUE,dis2==13? LCD_GRAY:LCD_WHITE,16);
-            lcd_show_int_num(240,124,eat_2[1],3,LCD_DARKBLUE,dis2==14? LCD_GRAY:LCD_WHITE,16);
-            lcd_show_int_num(240,148,eat_2[2],3,LCD_DARKBLUE,dis2==15? LCD_GRAY:LCD_WHITE,16);
-            lcd_show_int_num(240,171,eat_3[0],3,LCD_DARKBLUE,dis2==16? LCD_GRAY:LCD_WHITE,16);
-            lcd_show_int_num(240,194,eat_3[1],3,LCD_DARKBLUE,dis2==17? LCD_GRAY:LCD_WHITE,16);
-            lcd_show_int_num(240,218,eat_3[2],3,LCD_DARKBLUE,dis2==18? LCD_GRAY:LCD_WHITE,16);
-
-            lcd_draw_line(0,30,320,30,LCD_BLACK);
-            lcd_draw_line(0,100,320,100,LCD_BLACK);
-            lcd_draw_line(0,170,320,170,LCD_BLACK);
-            lcd_draw_line(140,53,320,53,LCD_BLACK);
-            lcd_draw_line(140,77,320,77,LCD_BLACK);
-            lcd_draw_line(140,123,320,123,LCD_BLACK);
-            lcd_draw_line(140,147,320,147,LCD_BLACK);
-            lcd_draw_line(140,193,320,193,LCD_BLACK);
-            lcd_draw_line(140,217,320,217,LCD_BLACK);
-
-
-            lcd_show_chinese(60,0,"存储时间",LCD_DARKBLUE,LCD_WHITE,16,0);
-            lcd_show_chinese(150,0,"吃药时间",LCD_DARKBLUE,LCD_WHITE,16,0);
-            lcd_show_chinese(240,0,"吃药数量",LCD_DARKBLUE,LCD_WHITE,16,0);
-
-            lcd_show_chinese(0,70,"一号",LCD_DARKBLUE,LCD_WHITE,24,0);         
-            lcd_show_chinese(0,140,"二号",LCD_DARKBLUE,LCD_WHITE,24,0);        
-            lcd_show_chinese(0,210,"三号",LCD_DARKBLUE,LCD_WHITE,24,0);
-            
-            break;
+            smart_box_display_sensor(chart_sum[0] / chart_count, chart_sum[1] / chart_count,
+                chart_sum[2] / chart_count, chart_sum[3] / chart_count);
+            memset(chart_sum, 0, sizeof(chart_sum));
+            chart_count = 0;
+            chart_tick = LOS_TickCountGet();
+        }
 
+        /* 报警或数据变化较快时保持活跃，否则按没有活动的时间进入慢速、休眠 */
+        if (light_state || beep_state
+            || (ui_valid && ((fabs(lum - last[0]) > GOV_RATE_LUM * dt)
+                || (fabs(humi - last[1]) > GOV_RATE_HUMI * dt)
+                || (fabs(temp - last[2]) > GOV_RATE_TEMP * dt)
+                || (fabs(gas - last[3]) > GOV_RATE_GAS * dt))))
+        {
+            smart_box_gov_wake();
         }
-        
-        
-        //lcd_show_ui();
+        smart_box_gov_update();
+        last[0] = lum;
+        last[1] = humi;
+        last[2] = temp;
+        last[3] = gas;
+
+        /* 提交界面数据，由显示任务只重绘有变化的控件；休眠后不再提交 */
+        ui.lum = lum;
+        ui.humi = humi;
+        ui.temp = temp;
+        ui.gas = gas;
+        if ((m_gov_state != GOV_SLEEP) || (ui.power != LCD_POWER_SLEEP))
+        {
+            smart_box_post_ui(&ui);
+        }
+        ui_valid = 1;
     }
 }
 
@@ -9,8 +9,13 @@
 #define SHT30_I2C_ADDRESS 0x44
 #define BH1750_I2C_ADDRESS 0x23
 #define MPU6050_I2C_ADDRESS 0x68
+#define MPU6050_RETRY_READS 10      // MPU6050出错后每隔多少次读取重新初始化一次
 #define BEEP_PORT EPWMDEV_PWM5_M0
 #define GPIO_BODY_INDUCTION GPIO0_PA3
+
+/* MPU6050状态：初始化时检查ID，读取出错后置0，之后由mpu6050_read_data定期重新初始化 */
+static uint8_t m_mpu6050_ok = 0;
+static uint8_t m_mpu6050_retry = 0;
 /***************************************************************
  * 函数名称: sht30_init
  * 说    明: sht30初始化
@@ -203,7 +208,7 @@ void bh1750_read_data(double *dat)
  *          value：值
  * 返 回 值: 操作结果
  ***************************************************************/
-static uint8_t MPU6050_Read_Buffer(uint8_t reg, uint8_t *p_buffer, uint16_t length)
+static uint32_t MPU6050_Read_Buffer(uint8_t reg, uint8_t *p_buffer, uint16_t length)
 {
 
     uint32_t status = 0;
@@ -216,7 +221,12 @@ static uint8_t MPU6050_Read_Buffer(uint8_t reg, uint8_t *p_buffer, uint16_t leng
         return status;
     }
 
-    IoTI2cRead(I2C_HANDLE, MPU6050_SLAVE_ADDRESS, p_buffer, length);
+    status = IoTI2cRead(I2C_HANDLE, MPU6050_SLAVE_ADDRESS, p_buffer, length);
+    if (status != IOT_SUCCESS)
+    {
+        printf("Error: I2C read status:%d\n", status);
+        return status;
+    }
     return IOT_SUCCESS;
 }
 
@@ -240,26 +250,30 @@ static void mpu6050_write_reg(uint8_t reg, uint8_t data)
  * 参    数:  reg：目标寄存器
  *          buf：缓冲区
  *          length：长度
- * 返 回 值: 无
+ * 返 回 值: uint32_t IOT_SUCCESS表示成功 IOT_FAILURE表示失败
  ***************************************************************/
-static void mpu6050_read_register(uint8_t reg, unsigned char *buf, uint8_t length)
+static uint32_t mpu6050_read_register(uint8_t reg, unsigned char *buf, uint8_t length)
 {
-    MPU6050_Read_Buffer(reg, buf, length);
+    return (MPU6050_Read_Buffer(reg, buf, length) == IOT_SUCCESS) ? IOT_SUCCESS : IOT_FAILURE;
 }
 
 /***************************************************************
  * 函数名称: mpu6050_read_acc
- * 说    明: 读取MPU6050的加速度数据
+ * 说    明: 读取MPU6050的加速度数据，三轴6个寄存器一次连续读出
  * 参    数:  acc_data：加速度数据
- * 返 回 值: 无
+ * 返 回 值: uint32_t IOT_SUCCESS表示成功 IOT_FAILURE表示失败
  ***************************************************************/
-static void mpu6050_read_acc(short *acc_data)
+static uint32_t mpu6050_read_acc(short *acc_data)
 {
     uint8_t buf[6];
-    mpu6050_read_register(MPU6050_ACC_OUT, buf, 6);
+    if (mpu6050_read_register(MPU6050_ACC_OUT, buf, 6) != IOT_SUCCESS)
+    {
+        return IOT_FAILURE;
+    }
     acc_data[0] = (buf[0] << 8) | buf[1];
     acc_data[1] = (buf[2] << 8) | buf[3];
     acc_data[2] = (buf[4] << 8) | buf[5];
+    return IOT_SUCCESS;
 }
 
 /***************************************************************
@@ -274,32 +288,10 @@ static void action_interrupt()
     mpu6050_write_reg(MPU6050_RA_MOT_DUR, 0x14); // 检测时间20ms 单位1ms
 }
 
-/***************************************************************
- * 函数名称: mpu6050_init
- * 说    明: mpu6050初始化
- * 参    数: 无
- * 返 回 值: 无
- ***************************************************************/
-void mpu6050_init(void)
-{
-    mpu6050_write_reg(MPU6050_RA_PWR_MGMT_1, 0X80); // 复位MPU6050
-    LOS_Msleep(200);
-    mpu6050_write_reg(MPU6050_RA_PWR_MGMT_1, 0X00);   // 唤醒MPU6050
-    mpu6050_write_reg(MPU6050_RA_INT_ENABLE, 0X00);   // 关闭所有中断
-    mpu6050_write_reg(MPU6050_RA_USER_CTRL, 0X00);    // I2C主模式关闭
-    mpu6050_write_reg(MPU6050_RA_FIFO_EN, 0X00);      // 关闭FIFO
-    mpu6050_write_reg(MPU6050_RA_INT_PIN_CFG, 0X80);  // 中断的逻辑电平模式,设置为0，中断信号为高电；设置为1，中断信号为低电平时。
-    action_interrupt();                               // 运动中断
-    mpu6050_write_reg(MPU6050_RA_CONFIG, 0x04);       // 配置外部引脚采样和DLPF数字低通滤波器
-    mpu6050_write_reg(MPU6050_RA_ACCEL_CONFIG, 0x1C); // 加速度传感器量程和高通滤波器配置
-    mpu6050_write_reg(MPU6050_RA_INT_PIN_CFG, 0X1C);  // INT引脚低电平平时
-    mpu6050_write_reg(MPU6050_RA_INT_ENABLE, 0x40);   // 中断使能寄存器
-}
-
 /***************************************************************
  * 函数功能: 读取MPU6050的ID
  * 输入参数: 无
- * 返 回 值: 无
+ * 返 回 值: 1表示ID正确，0表示读取失败或ID错误
  * 说    明: 无
  ***************************************************************/
 static uint8_t mpu6050_read_id()
@@ -318,25 +310,71 @@ static uint8_t mpu6050_read_id()
 }
 
 /***************************************************************
- * 函数名称: mpu6050_read_data
- * 说    明: 读取数据
+ * 函数名称: mpu6050_init
+ * 说    明: mpu6050初始化，复位后先检查ID，ID不对时不再配置
  * 参    数: 无
- * 返 回 值: 无
+ * 返 回 值: uint32_t IOT_SUCCESS表示成功 IOT_FAILURE表示失败
  ***************************************************************/
-void mpu6050_read_data(short *dat)
+uint32_t mpu6050_init(void)
 {
-    short accel[3];
-    short temp;
+    mpu6050_write_reg(MPU6050_RA_PWR_MGMT_1, 0X80); // 复位MPU6050
+    LOS_Msleep(200);
     if (mpu6050_read_id() == 0)
     {
-        while (1)
-            ;
+        m_mpu6050_ok = 0;
+        return IOT_FAILURE;
+    }
+    mpu6050_write_reg(MPU6050_RA_PWR_MGMT_1, 0X00);   // 唤醒MPU6050
+    mpu6050_write_reg(MPU6050_RA_INT_ENABLE, 0X00);   // 关闭所有中断
+    mpu6050_write_reg(MPU6050_RA_USER_CTRL, 0X00);    // I2C主模式关闭
+    mpu6050_write_reg(MPU6050_RA_FIFO_EN, 0X00);      // 关闭FIFO
+    mpu6050_write_reg(MPU6050_RA_INT_PIN_CFG, 0X80);  // 中断的逻辑电平模式,设置为0，中断信号为高电；设置为1，中断信号为低电平时。
+    action_interrupt();                               // 运动中断
+    mpu6050_write_reg(MPU6050_RA_CONFIG, 0x04);       // 配置外部引脚采样和DLPF数字低通滤波器
+    mpu6050_write_reg(MPU6050_RA_ACCEL_CONFIG, 0x1C); // 加速度传感器量程和高通滤波器配置
+    mpu6050_write_reg(MPU6050_RA_INT_PIN_CFG, 0X1C);  // INT引脚低电平平时
+    mpu6050_write_reg(MPU6050_RA_INT_ENABLE, 0x40);   // 中断使能寄存器
+    m_mpu6050_ok = 1;
+    return IOT_SUCCESS;
+}
+
+/***************************************************************
+ * 函数名称: mpu6050_read_data
+ * 说    明: 读取三轴加速度，不等待。MPU6050初始化失败或读取出错后
+ *           返回失败，每MPU6050_RETRY_READS次调用重新初始化一次
+ * 参    数:
+ *       @dat：加速度数据，失败时不修改
+ * 返 回 值: uint32_t IOT_SUCCESS表示成功 IOT_FAILURE表示失败
+ ***************************************************************/
+uint32_t mpu6050_read_data(short *dat)
+{
+    short accel[3];
+
+    /* 出错后不是每次都重新初始化，初始化中复位需要等待200ms */
+    if (!m_mpu6050_ok)
+    {
+        if (++m_mpu6050_retry < MPU6050_RETRY_READS)
+        {
+            return IOT_FAILURE;
+        }
+        m_mpu6050_retry = 0;
+        if (mpu6050_init() != IOT_SUCCESS)
+        {
+            return IOT_FAILURE;
+        }
+        printf("MPU6050 recovered\n");
+    }
+
+    if (mpu6050_read_acc(accel) != IOT_SUCCESS)
+    {
+        m_mpu6050_ok = 0;
+        m_mpu6050_retry = 0;
+        return IOT_FAILURE;
     }
-    mpu6050_read_acc(accel);
     dat[0] = accel[0];
     dat[1] = accel[1];
     dat[2] = accel[2];
-    LOS_Msleep(500);
+    return IOT_SUCCESS;
 }
 
 
@@ -351,7 +389,14 @@ void i2c_dev_init(void)
     IoTI2cInit(I2C_HANDLE, EI2C_FRE_400K);
     sht30_init();
     bh1750_init();
-    mpu6050_init();
+    /* MPU6050不在或ID不对时标记为不可用，读取直接返回失败，
+     * 主循环不使用加速度判断药盒倾倒，之后由mpu6050_read_data定期重试 */
+    if (mpu6050_init() != IOT_SUCCESS)
+    {
+        printf("MPU6050 init failure\n");
+        m_mpu6050_ok = 0;
+        m_mpu6050_retry = 0;
+    }
 }
 
 
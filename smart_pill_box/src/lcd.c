@@ -12,6 +12,13 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <stdio.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "los_task.h"
+#include "los_queue.h"
+#include "los_sem.h"
 #include "iot_errno.h"
 #include "iot_gpio.h"
 #include "iot_spi.h"
@@ -60,6 +67,170 @@ IoT_SPI_InitTypeDef iot_spi = {
 
 /////////////////////////////////////////////////////////////////
 
+/* 数据缓冲区大小(字节)，一行像素的数据量，数据攒满后一次性通过SPI发送 */
+#define LCD_BUF_SIZE        (LCD_W * 2)
+
+/* 是否启用显存缓冲(需要LCD_W*LCD_H*2字节RAM，320x240时为150KB)
+ * 0 => 绘图直接发送到LCD
+ * 1 => 绘图先写入RAM中的显存，调用lcd_flush()时只发送有变化的区块
+ * RK2206的256KB SRAM还要容纳LiteOS、WiFi协议栈和MQTT，默认不启用；
+ * 在BUILD.gn的defines中定义为1启用前，须确认链接map中.bss加堆栈的大小
+ */
+#ifndef LCD_ENABLE_FRAMEBUFFER
+#define LCD_ENABLE_FRAMEBUFFER  0
+#endif
+
+/* 是否启用异步发送
+ * 0 => 缓冲区攒满后由绘图的任务直接发送
+ * 1 => 两个缓冲区轮流使用，由发送任务在后台发送，绘图与SPI传输同时进行
+ */
+#define LCD_ENABLE_ASYNC    1
+
+#if LCD_ENABLE_ASYNC
+#define LCD_TX_QUEUE_LEN    16
+#define LCD_TX_TASK_STACK   1024
+/* 与显示任务(25)相同、低于主循环(24)的优先级：整屏填充等长时间的发送
+ * 不会推迟按键、报警和舵机的处理；绘图任务等待空闲缓冲区时发送任务运行 */
+#define LCD_TX_TASK_PRIO    25
+
+/* 发送队列中的命令类型 */
+#define LCD_TX_CMD          0       // 发送一个命令字节
+#define LCD_TX_DATA         1       // 发送缓冲区中的数据
+#define LCD_TX_SYNC         2       // 之前的数据已全部发送
+#define LCD_TX_EXT          3       // 发送缓冲区以外的数据(flash中的图片)，不占用缓冲区
+
+typedef struct
+{
+    uint8_t             type;
+    uint8_t             cmd;
+    uint16_t            repeat;     // 缓冲区重复发送次数
+    uint32_t            len;
+    const uint8_t      *buf;
+} lcd_tx_item_t;
+
+static uint8_t  m_lcd_bufs[2][LCD_BUF_SIZE];
+static uint8_t *m_lcd_buf = m_lcd_bufs[0];
+static uint32_t m_lcd_tx_queue;
+static uint32_t m_lcd_tx_sem;       // 空闲缓冲区个数
+static uint32_t m_lcd_sync_sem;
+static uint8_t  m_lcd_tx_started = 0;
+#else
+static uint8_t  m_lcd_buf[LCD_BUF_SIZE];
+#endif
+static uint32_t m_lcd_buf_len = 0;
+
+/* lcd_wr_ext每次交给SPI发送的最大字节数 */
+#define LCD_EXT_SLICE       8192
+
+/* RGB565颜色转换为RGB444(各分量取高4位) */
+#define LCD_RGB444(c)       ((((c) >> 4) & 0x0F00) | (((c) >> 3) & 0x00F0) | (((c) >> 1) & 0x000F))
+/* RGB444颜色按LCD控制器的方式扩展回RGB565 */
+#define LCD_RGB444_TO_565(c) ((uint16_t)((((c) & 0x0F00) << 4) | ((c) & 0x0800) | \
+                             (((c) & 0x00F0) << 3) | (((c) & 0x00C0) >> 1) | \
+                             (((c) & 0x000F) << 1) | (((c) & 0x0008) >> 3)))
+/* RGB444时缓冲区中可以放下的完整像素对个数，每对3字节 */
+#define LCD_BUF_PAIRS       (LCD_BUF_SIZE / 3)
+
+/* LCD控制器当前的地址窗口(0x2A/0x2B)，相同的坐标不再重复发送 */
+static uint8_t  m_lcd_win_valid = 0;
+static uint16_t m_lcd_win_x1, m_lcd_win_y1, m_lcd_win_x2, m_lcd_win_y2;
+/* 上一个命令是否为储存器写(0x2C)，及其后已发送的像素数据字节数，
+ * 写满整个窗口后写指针回到窗口起点，相同窗口可以直接接着写 */
+static uint8_t  m_lcd_ram_open = 0;
+static uint32_t m_lcd_ram_bytes = 0;
+
+/* 当前显示状态，见lcd_set_power */
+static uint8_t  m_lcd_power = LCD_POWER_ON;
+/* 调低亮度时的亮度(0x51)，0xFF为最亮 */
+#define LCD_DIM_BRIGHTNESS  0x30
+
+/* 当前像素格式(0x3A) */
+static uint8_t  m_lcd_pixfmt = LCD_PIXEL_RGB565;
+/* RGB444时两个像素合为3字节发送，m_lcd_half为等待配对的前一个像素 */
+static uint16_t m_lcd_half;
+static uint8_t  m_lcd_half_len = 0;
+
+/* 是否启用绘图统计，按绘图函数类别和帧统计发送的数据量及耗时 */
+#define LCD_ENABLE_STATS    1
+
+#if LCD_ENABLE_STATS
+static lcd_stat_t m_lcd_stats[LCD_STAT_MAX];
+static lcd_stat_t m_lcd_frame;          // 正在绘制的帧
+static lcd_stat_t m_lcd_last_frame;     // 上一个完整的帧
+static uint8_t  m_lcd_stat_type = LCD_STAT_OTHER;
+static uint8_t  m_lcd_stat_depth = 0;
+static uint64_t m_lcd_stat_start;
+
+/***************************************************************
+ * 函数名称: lcd_stat_begin
+ * 说    明: 开始统计一次绘图函数调用，嵌套调用只统计最外层
+ * 参    数:
+ *       @type：统计类别
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_stat_begin(uint8_t type)
+{
+    if (m_lcd_stat_depth++ == 0)
+    {
+        m_lcd_stat_type = type;
+        m_lcd_stat_start = LOS_TickCountGet();
+        m_lcd_stats[type].calls++;
+        m_lcd_frame.calls++;
+    }
+}
+
+/***************************************************************
+ * 函数名称: lcd_stat_end
+ * 说    明: 结束统计一次绘图函数调用
+ * 参    数: 无
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_stat_end(void)
+{
+    uint32_t ticks;
+
+    if (--m_lcd_stat_depth == 0)
+    {
+        ticks = (uint32_t)(LOS_TickCountGet() - m_lcd_stat_start);
+        m_lcd_stats[m_lcd_stat_type].ticks += ticks;
+        m_lcd_frame.ticks += ticks;
+        m_lcd_stat_type = LCD_STAT_OTHER;
+    }
+}
+
+/***************************************************************
+ * 函数名称: lcd_stat_bus
+ * 说    明: 记录发送到总线的数据，计入当前绘图函数的类别
+ * 参    数:
+ *       @bytes：字节数
+ *       @writes：IoTSpiWrite调用次数
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_stat_bus(uint32_t bytes, uint32_t writes)
+{
+    m_lcd_stats[m_lcd_stat_type].bytes += bytes;
+    m_lcd_stats[m_lcd_stat_type].writes += writes;
+    m_lcd_frame.bytes += bytes;
+    m_lcd_frame.writes += writes;
+}
+
+static void lcd_stat_window(void)
+{
+    m_lcd_stats[m_lcd_stat_type].windows++;
+    m_lcd_frame.windows++;
+}
+
+#define LCD_STAT_BEGIN(type)        lcd_stat_begin(type)
+#define LCD_STAT_END()              lcd_stat_end()
+#define LCD_STAT_BUS(bytes, writes) lcd_stat_bus(bytes, writes)
+#define LCD_STAT_WINDOW()           lcd_stat_window()
+#else
+#define LCD_STAT_BEGIN(type)
+#define LCD_STAT_END()
+#define LCD_STAT_BUS(bytes, writes)
+#define LCD_STAT_WINDOW()
+#endif
+
 static void lcd_write_bus(uint8_t dat)
 {
 #if LCD_ENABLE_SPI
@@ -86,359 +257,1112 @@ static void lcd_write_bus(uint8_t dat)
 #endif
 }
 
+/***************************************************************
+ * 函数名称: lcd_write_bus_buf
+ * 说    明: 一次性发送一段数据
+ * 参    数:
+ *       @buf：数据
+ *       @len：数据长度
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_write_bus_buf(const uint8_t *buf, uint32_t len)
+{
+#if LCD_ENABLE_SPI
+    IoTSpiWrite(LCD_SPI_BUS, (uint8_t *)buf, len);
+#else
+    uint32_t i;
+
+    for (i = 0; i < len; i++)
+    {
+        lcd_write_bus(buf[i]);
+    }
+#endif
+}
+
+/***************************************************************
+ * 函数名称: lcd_write_bus_cmd
+ * 说    明: 发送一个命令字节
+ * 参    数:
+ *       @cmd：命令
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_write_bus_cmd(uint8_t cmd)
+{
+    LCD_DC_Clr();
+    lcd_write_bus(cmd);
+    LCD_DC_Set();
+}
+
+#if LCD_ENABLE_ASYNC
+/***************************************************************
+ * 函数名称: lcd_tx_thread
+ * 说    明: 发送任务，按顺序发送队列中的命令和数据
+ * 参    数:
+ *       @arg：未使用
+ * 返 回 值: 无
+ ***************************************************************/
+static void *lcd_tx_thread(uint32_t arg)
+{
+    lcd_tx_item_t item;
+    uint32_t size;
+
+    (void)arg;
+    while (1)
+    {
+        size = sizeof(item);
+        if (LOS_QueueReadCopy(m_lcd_tx_queue, &item, &size, LOS_WAIT_FOREVER) != LOS_OK)
+        {
+            continue;
+        }
+
+        switch (item.type)
+        {
+            case LCD_TX_CMD:
+                lcd_write_bus_cmd(item.cmd);
+                break;
+            case LCD_TX_DATA:
+                while (item.repeat-- > 0)
+                {
+                    lcd_write_bus_buf(item.buf, item.len);
+                }
+                /* 缓冲区发送完毕，可以重新填充 */
+                LOS_SemPost(m_lcd_tx_sem);
+                break;
+            case LCD_TX_SYNC:
+                LOS_SemPost(m_lcd_sync_sem);
+                break;
+            case LCD_TX_EXT:
+                lcd_write_bus_buf(item.buf, item.len);
+                break;
+            default:
+                break;
+        }
+    }
+    return NULL;
+}
+
+/***************************************************************
+ * 函数名称: lcd_tx_init
+ * 说    明: 创建发送队列和发送任务
+ * 参    数: 无
+ * 返 回 值: 返回0为成功，反之为失败
+ ***************************************************************/
+static unsigned int lcd_tx_init(void)
+{
+    TSK_INIT_PARAM_S task = {0};
+    uint32_t task_id;
+
+    if (m_lcd_tx_started)
+    {
+        return 0;
+    }
+
+    /* 当前缓冲区由绘图使用，另一个缓冲区空闲 */
+    if ((LOS_QueueCreate("lcdTxQ", LCD_TX_QUEUE_LEN, &m_lcd_tx_queue, 0, sizeof(lcd_tx_item_t)) != LOS_OK)
+        || (LOS_SemCreate(1, &m_lcd_tx_sem) != LOS_OK)
+        || (LOS_SemCreate(0, &m_lcd_sync_sem) != LOS_OK))
+    {
+        printf("%s, %s, %d: Lcd tx queue init failed!\n",
+         __FILE__, __func__, __LINE__);
+        return IOT_FAILURE;
+    }
+
+    task.pfnTaskEntry = lcd_tx_thread;
+    task.uwStackSize = LCD_TX_TASK_STACK;
+    task.pcName = "lcd tx thread";
+    task.usTaskPrio = LCD_TX_TASK_PRIO;
+    if (LOS_TaskCreate(&task_id, &task) != LOS_OK)
+    {
+        printf("%s, %s, %d: Lcd tx task create failed!\n",
+         __FILE__, __func__, __LINE__);
+        return IOT_FAILURE;
+    }
+
+    m_lcd_tx_started = 1;
+    return 0;
+}
+
+/***************************************************************
+ * 函数名称: lcd_tx_post
+ * 说    明: 向发送任务提交一项内容
+ * 参    数:
+ *       @type：类型
+ *       @cmd：命令字节(LCD_TX_CMD)
+ *       @buf：数据(LCD_TX_DATA、LCD_TX_EXT)
+ *       @len：数据长度(LCD_TX_DATA、LCD_TX_EXT)
+ *       @repeat：重复发送次数(LCD_TX_DATA)
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_tx_post(uint8_t type, uint8_t cmd, const uint8_t *buf, uint32_t len, uint16_t repeat)
+{
+    lcd_tx_item_t item;
+
+    item.type = type;
+    item.cmd = cmd;
+    item.repeat = repeat;
+    item.len = len;
+    item.buf = buf;
+    LOS_QueueWriteCopy(m_lcd_tx_queue, &item, sizeof(item), LOS_WAIT_FOREVER);
+}
+#endif
+
+/***************************************************************
+ * 函数名称: lcd_wr_send
+ * 说    明: 将当前缓冲区的前len字节发送repeat次，之后缓冲区可重新填充
+ * 参    数:
+ *       @len：数据长度
+ *       @repeat：重复次数
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_wr_send(uint32_t len, uint16_t repeat)
+{
+    LCD_STAT_BUS(len * repeat, repeat);
+    m_lcd_ram_bytes += len * repeat;
+#if LCD_ENABLE_ASYNC
+    lcd_tx_post(LCD_TX_DATA, 0, m_lcd_buf, len, repeat);
+    /* 换到另一个缓冲区，若其仍在发送则等待发送完成 */
+    LOS_SemPend(m_lcd_tx_sem, LOS_WAIT_FOREVER);
+    m_lcd_buf = (m_lcd_buf == m_lcd_bufs[0]) ? m_lcd_bufs[1] : m_lcd_bufs[0];
+#else
+    while (repeat-- > 0)
+    {
+        lcd_write_bus_buf(m_lcd_buf, len);
+    }
+#endif
+}
+
+/***************************************************************
+ * 函数名称: lcd_wr_flush
+ * 说    明: 将缓冲区中的数据发送出去
+ * 参    数: 无
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_wr_flush(void)
+{
+    if (m_lcd_buf_len == 0)
+    {
+        return;
+    }
+
+    lcd_wr_send(m_lcd_buf_len, 1);
+    m_lcd_buf_len = 0;
+}
+
 static void lcd_wr_data8(uint8_t dat)
 {
-    lcd_write_bus(dat);
+    m_lcd_buf[m_lcd_buf_len++] = dat;
+    if (m_lcd_buf_len >= LCD_BUF_SIZE)
+    {
+        lcd_wr_flush();
+    }
 }
 
 static void lcd_wr_data(uint16_t dat)
 {
-    lcd_write_bus(dat >> 8);
-    lcd_write_bus(dat);
+    lcd_wr_data8(dat >> 8);
+    lcd_wr_data8(dat);
+}
+
+/***************************************************************
+ * 函数名称: lcd_wr_pixel
+ * 说    明: 按当前像素格式写入一个像素
+ * 参    数:
+ *       @color：像素颜色(RGB565)
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_wr_pixel(uint16_t color)
+{
+    uint16_t c;
+
+    if (m_lcd_pixfmt != LCD_PIXEL_RGB444)
+    {
+        lcd_wr_data(color);
+        return;
+    }
+
+    /* 每两个像素打包为3字节：R1G1 B1R2 G2B2 */
+    c = LCD_RGB444(color);
+    if (m_lcd_half_len == 0)
+    {
+        m_lcd_half = c;
+        m_lcd_half_len = 1;
+        return;
+    }
+    lcd_wr_data8(m_lcd_half >> 4);
+    lcd_wr_data8((m_lcd_half << 4) | (c >> 8));
+    lcd_wr_data8(c);
+    m_lcd_half_len = 0;
 }
 
+/***************************************************************
+ * 函数名称: lcd_wr_end
+ * 说    明: 结束像素数据：补齐最后一个未配对的像素并发送缓冲区
+ * 参    数: 无
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_wr_end(void)
+{
+    if (m_lcd_half_len != 0)
+    {
+        /* 剩余4位为填充，下一个命令到来时被LCD丢弃 */
+        lcd_wr_data8(m_lcd_half >> 4);
+        lcd_wr_data8(m_lcd_half << 4);
+        m_lcd_half_len = 0;
+    }
+    lcd_wr_flush();
+}
+
+#if !LCD_ENABLE_FRAMEBUFFER
+/***************************************************************
+ * 函数名称: lcd_wr_bytes
+ * 说    明: 写入一段数据(如图片内容)
+ * 参    数:
+ *       @dat：数据
+ *       @len：数据长度
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_wr_bytes(const uint8_t *dat, uint32_t len)
+{
+    uint32_t n;
+
+    while (len > 0)
+    {
+        n = LCD_BUF_SIZE - m_lcd_buf_len;
+        if (n > len)
+        {
+            n = len;
+        }
+        memcpy(&m_lcd_buf[m_lcd_buf_len], dat, n);
+        m_lcd_buf_len += n;
+        dat += n;
+        len -= n;
+        if (m_lcd_buf_len >= LCD_BUF_SIZE)
+        {
+            lcd_wr_flush();
+        }
+    }
+}
+#endif
+
+/***************************************************************
+ * 函数名称: lcd_wr_ext
+ * 说    明: 不经过缓冲区，直接把一段数据交给SPI发送，每次最多
+ *           LCD_EXT_SLICE字节；异步发送时函数返回后数据可能还在发送，
+ *           数据必须一直有效(如flash中的常量数组)
+ * 参    数:
+ *       @dat：数据
+ *       @len：数据长度
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_wr_ext(const uint8_t *dat, uint32_t len)
+{
+    uint32_t n;
+
+    /* 缓冲区中已有的数据先发送，保证顺序 */
+    lcd_wr_flush();
+    while (len > 0)
+    {
+        n = (len > LCD_EXT_SLICE) ? LCD_EXT_SLICE : len;
+        LCD_STAT_BUS(n, 1);
+        m_lcd_ram_bytes += n;
+#if LCD_ENABLE_ASYNC
+        lcd_tx_post(LCD_TX_EXT, 0, dat, n, 1);
+#else
+        lcd_write_bus_buf(dat, n);
+#endif
+        dat += n;
+        len -= n;
+    }
+}
+
+#if !LCD_ENABLE_FRAMEBUFFER
+/***************************************************************
+ * 函数名称: lcd_wr_color
+ * 说    明: 连续写入count个相同颜色的像素
+ * 参    数:
+ *       @color：颜色
+ *       @count：像素个数
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_wr_color(uint16_t color, uint32_t count)
+{
+    uint32_t i, n;
+    uint16_t c;
+
+    if (m_lcd_pixfmt == LCD_PIXEL_RGB444)
+    {
+        /* 先与未配对的像素凑成一对 */
+        if ((count > 0) && (m_lcd_half_len != 0))
+        {
+            lcd_wr_pixel(color);
+            count--;
+        }
+        if (count >= LCD_BUF_PAIRS * 2)
+        {
+            /* 重复发送的缓冲区必须从像素对开始，已有的数据先发送 */
+            lcd_wr_flush();
+            c = LCD_RGB444(color);
+            for (i = 0; i < LCD_BUF_PAIRS; i++)
+            {
+                m_lcd_buf[i * 3] = c >> 4;
+                m_lcd_buf[i * 3 + 1] = (c << 4) | (c >> 8);
+                m_lcd_buf[i * 3 + 2] = c;
+            }
+            lcd_wr_send(LCD_BUF_PAIRS * 3, count / (LCD_BUF_PAIRS * 2));
+            count %= LCD_BUF_PAIRS * 2;
+        }
+        for (n = 0; n < count; n++)
+        {
+            lcd_wr_pixel(color);
+        }
+        return;
+    }
+
+    /* 缓冲区中已有数据时先追加到缓冲区，短的颜色段不单独发送 */
+    while ((count > 0) && (m_lcd_buf_len != 0))
+    {
+        lcd_wr_data(color);
+        count--;
+    }
+
+    if (count >= LCD_BUF_SIZE / 2)
+    {
+        /* 缓冲区只需填充一次，之后重复发送 */
+        for (i = 0; i < LCD_BUF_SIZE / 2; i++)
+        {
+            m_lcd_buf[i * 2] = color >> 8;
+            m_lcd_buf[i * 2 + 1] = color;
+        }
+        lcd_wr_send(LCD_BUF_SIZE, count / (LCD_BUF_SIZE / 2));
+        count %= LCD_BUF_SIZE / 2;
+    }
+
+    /* 剩余不足一整块的像素留在缓冲区中，与后续数据一起发送 */
+    for (n = 0; n < count; n++)
+    {
+        lcd_wr_data(color);
+    }
+}
+#endif
+
 static void lcd_wr_reg(uint8_t dat)
 {
-    LCD_DC_Clr();
-    lcd_write_bus(dat);
-    LCD_DC_Set();
+    /* 切换DC前先发送完缓冲区中的数据 */
+    lcd_wr_end();
+    LCD_STAT_BUS(1, 1);
+    m_lcd_ram_open = (dat == 0x2c);
+#if LCD_ENABLE_ASYNC
+    lcd_tx_post(LCD_TX_CMD, dat, NULL, 0, 0);
+#else
+    lcd_write_bus_cmd(dat);
+#endif
 }
 
+/***************************************************************
+ * 函数名称: lcd_address_set
+ * 说    明: 设置LCD地址窗口并开始写储存器，与LCD当前窗口相同的
+ *           列/行地址不再发送；窗口不变且上次已写满整个窗口时，
+ *           写指针已回到起点，连储存器写命令也不发送
+ * 参    数:
+ *       @x1,y1：窗口起始点坐标
+ *       @x2,y2：窗口结束点坐标
+ * 返 回 值: 无
+ ***************************************************************/
 static void lcd_address_set(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
 {
-    /* 列地址设置 */
-    lcd_wr_reg(0x2a);
-    lcd_wr_data(x1);
-    lcd_wr_data(x2);
-    /* 行地址设置 */
-    lcd_wr_reg(0x2b);
-    lcd_wr_data(y1);
-    lcd_wr_data(y2);
-    /* 储存器写 */
+    uint32_t area = (uint32_t)(x2 - x1 + 1) * (y2 - y1 + 1);
+    uint32_t win_bytes;
+    uint8_t same_x, same_y;
+
+    same_x = m_lcd_win_valid && (x1 == m_lcd_win_x1) && (x2 == m_lcd_win_x2);
+    same_y = m_lcd_win_valid && (y1 == m_lcd_win_y1) && (y2 == m_lcd_win_y2);
+
+    if (same_x && same_y && m_lcd_ram_open && (m_lcd_half_len == 0))
+    {
+        /* RGB444时奇数个像素的窗口末尾有填充，写指针不在起点 */
+        win_bytes = (m_lcd_pixfmt == LCD_PIXEL_RGB444) ? ((area & 1) ? 0 : area * 3 / 2) : area * 2;
+        if ((win_bytes != 0) && ((m_lcd_ram_bytes + m_lcd_buf_len) % win_bytes == 0))
+        {
+            return;
+        }
+    }
+
+    LCD_STAT_WINDOW();
+    if (!same_x)
+    {
+        /* 列地址设置 */
+        lcd_wr_reg(0x2a);
+        lcd_wr_data(x1);
+        lcd_wr_data(x2);
+    }
+    if (!same_y)
+    {
+        /* 行地址设置 */
+        lcd_wr_reg(0x2b);
+        lcd_wr_data(y1);
+        lcd_wr_data(y2);
+    }
+    m_lcd_win_x1 = x1;
+    m_lcd_win_y1 = y1;
+    m_lcd_win_x2 = x2;
+    m_lcd_win_y2 = y2;
+    m_lcd_win_valid = 1;
+    /* 储存器写，写指针回到窗口起点 */
     lcd_wr_reg(0x2c);
+    m_lcd_ram_bytes = 0;
 }
 
-static uint32_t mypow(uint8_t m, uint8_t n)
+#if LCD_ENABLE_FRAMEBUFFER
+/* 区块大小，显存按区块记录是否有变化 */
+#define LCD_TILE_SIZE       16
+#define LCD_TILE_COLS       ((LCD_W + LCD_TILE_SIZE - 1) / LCD_TILE_SIZE)
+#define LCD_TILE_ROWS       ((LCD_H + LCD_TILE_SIZE - 1) / LCD_TILE_SIZE)
+
+static uint16_t m_lcd_fb[LCD_H][LCD_W];
+/* 每行区块的变化标志，bit n对应第n列区块 */
+static uint32_t m_lcd_dirty[LCD_TILE_ROWS];
+/* 以RGB444发送、LCD上的颜色与显存不完全一致的区块，切换回RGB565时重新发送 */
+static uint32_t m_lcd_lossy[LCD_TILE_ROWS];
+
+/* 当前绘图窗口及写指针 */
+static uint16_t m_win_x1, m_win_y1, m_win_x2, m_win_y2;
+static uint16_t m_win_x, m_win_y;
+
+/* 写入显存后未被覆盖的flash图片，刷新时整个窗口直接从flash发送 */
+#define LCD_BLIT_MAX        4
+
+typedef struct
 {
-    uint32_t result = 1;
-    
-    while (n--)
+    uint16_t            x1, y1, x2, y2;
+    const uint8_t      *dat;
+} lcd_blit_t;
+
+static lcd_blit_t m_lcd_blits[LCD_BLIT_MAX];
+static uint8_t  m_lcd_blit_num = 0;
+#endif
+
+/* 0x36中MY为1时(USE_HORIZONTAL为1或3)，显存行与屏幕滚动方向的坐标相反 */
+#define LCD_SCROLL_MIRROR   ((USE_HORIZONTAL == 1) || (USE_HORIZONTAL == 3))
+
+/* 当前滚动区(屏幕坐标) */
+static uint16_t m_lcd_scroll_start = 0;
+static uint16_t m_lcd_scroll_len = LCD_SCROLL_LINES;
+
+/***************************************************************
+ * 函数名称: lcd_win_set
+ * 说    明: 设置绘图窗口，之后写入的像素从窗口左上角开始逐行填充
+ * 参    数:
+ *       @x1：窗口起始点X坐标
+ *       @y1：窗口起始点Y坐标
+ *       @x2：窗口结束点X坐标
+ *       @y2：窗口结束点Y坐标
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_win_set(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
+{
+#if LCD_ENABLE_FRAMEBUFFER
+    uint8_t i = 0;
+
+    /* 窗口内的显存将被改写，与之重叠的图片不再能从flash发送 */
+    while (i < m_lcd_blit_num)
     {
-        result *= m;
+        if ((x1 <= m_lcd_blits[i].x2) && (x2 >= m_lcd_blits[i].x1)
+            && (y1 <= m_lcd_blits[i].y2) && (y2 >= m_lcd_blits[i].y1))
+        {
+            m_lcd_blits[i] = m_lcd_blits[--m_lcd_blit_num];
+            continue;
+        }
+        i++;
     }
-    
-    return result;
+
+    m_win_x1 = x1;
+    m_win_y1 = y1;
+    m_win_x2 = x2;
+    m_win_y2 = y2;
+    m_win_x = x1;
+    m_win_y = y1;
+#else
+    lcd_address_set(x1, y1, x2, y2);
+#endif
+}
+
+/***************************************************************
+ * 函数名称: lcd_win_pixel
+ * 说    明: 向绘图窗口写入一个像素
+ * 参    数:
+ *       @color：像素颜色
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_win_pixel(uint16_t color)
+{
+#if LCD_ENABLE_FRAMEBUFFER
+    uint16_t *p;
+
+    if ((m_win_x < LCD_W) && (m_win_y < LCD_H))
+    {
+        p = &m_lcd_fb[m_win_y][m_win_x];
+        if (*p != color)
+        {
+            *p = color;
+            m_lcd_dirty[m_win_y / LCD_TILE_SIZE] |= (1u << (m_win_x / LCD_TILE_SIZE));
+        }
+    }
+
+    /* 与LCD控制器一致：写到行尾换行，写到窗口末尾回到起点 */
+    if (++m_win_x > m_win_x2)
+    {
+        m_win_x = m_win_x1;
+        if (++m_win_y > m_win_y2)
+        {
+            m_win_y = m_win_y1;
+        }
+    }
+#else
+    lcd_wr_pixel(color);
+#endif
+}
+
+/***************************************************************
+ * 函数名称: lcd_win_color
+ * 说    明: 向绘图窗口连续写入count个相同颜色的像素
+ * 参    数:
+ *       @color：像素颜色
+ *       @count：像素个数
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_win_color(uint16_t color, uint32_t count)
+{
+#if LCD_ENABLE_FRAMEBUFFER
+    while (count--)
+    {
+        lcd_win_pixel(color);
+    }
+#else
+    lcd_wr_color(color, count);
+#endif
+}
+
+/***************************************************************
+ * 函数名称: lcd_win_bytes
+ * 说    明: 向绘图窗口写入RGB565(高字节在前)格式的像素数据
+ * 参    数:
+ *       @dat：像素数据
+ *       @len：数据长度(字节)
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_win_bytes(const uint8_t *dat, uint32_t len)
+{
+#if LCD_ENABLE_FRAMEBUFFER
+    uint32_t i;
+
+    for (i = 0; i + 1 < len; i += 2)
+    {
+        lcd_win_pixel(((uint16_t)dat[i] << 8) | dat[i + 1]);
+    }
+#else
+    uint32_t i;
+
+    if (m_lcd_pixfmt == LCD_PIXEL_RGB444)
+    {
+        for (i = 0; i + 1 < len; i += 2)
+        {
+            lcd_wr_pixel(((uint16_t)dat[i] << 8) | dat[i + 1]);
+        }
+        return;
+    }
+    lcd_wr_bytes(dat, len);
+#endif
+}
+
+/***************************************************************
+ * 函数名称: lcd_win_image
+ * 说    明: 向绘图窗口写入flash中RGB565(高字节在前)格式的像素数据。
+ *           不使用显存且为RGB565时直接从flash发送，不复制；使用显存时
+ *           仍写入显存，并记下图片，刷新时若未被覆盖则整个窗口从flash发送
+ * 参    数:
+ *       @dat：像素数据，须一直有效
+ *       @len：数据长度(字节)，须为整个窗口
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_win_image(const uint8_t *dat, uint32_t len)
+{
+#if LCD_ENABLE_FRAMEBUFFER
+    lcd_blit_t *b;
+
+    lcd_win_bytes(dat, len);
+    if ((m_win_x2 < LCD_W) && (m_win_y2 < LCD_H) && (m_lcd_blit_num < LCD_BLIT_MAX)
+        && (len == (uint32_t)(m_win_x2 - m_win_x1 + 1) * (m_win_y2 - m_win_y1 + 1) * 2))
+    {
+        b = &m_lcd_blits[m_lcd_blit_num++];
+        b->x1 = m_win_x1;
+        b->y1 = m_win_y1;
+        b->x2 = m_win_x2;
+        b->y2 = m_win_y2;
+        b->dat = dat;
+    }
+#else
+    if (m_lcd_pixfmt != LCD_PIXEL_RGB444)
+    {
+        lcd_wr_ext(dat, len & ~1u);
+        return;
+    }
+    lcd_win_bytes(dat, len);
+#endif
+}
+
+/***************************************************************
+ * 函数名称: lcd_win_end
+ * 说    明: 结束本次绘图
+ * 参    数: 无
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_win_end(void)
+{
+#if !LCD_ENABLE_FRAMEBUFFER
+    lcd_wr_end();
+#endif
+}
+
+/***************************************************************
+ * 函数名称: lcd_fill_area
+ * 说    明: 用一个窗口填充矩形区域(包含结束点)，超出屏幕的部分被裁剪
+ * 参    数:
+ *       @x1,y1：区域起始点坐标
+ *       @x2,y2：区域结束点坐标
+ *       @color：颜色
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_fill_area(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color)
+{
+    if ((x1 >= LCD_W) || (y1 >= LCD_H) || (x2 < x1) || (y2 < y1))
+    {
+        return;
+    }
+    if (x2 >= LCD_W)
+    {
+        x2 = LCD_W - 1;
+    }
+    if (y2 >= LCD_H)
+    {
+        y2 = LCD_H - 1;
+    }
+
+    lcd_win_set(x1, y1, x2, y2);
+    lcd_win_color(color, (uint32_t)(x2 - x1 + 1) * (y2 - y1 + 1));
+    lcd_win_end();
+}
+
+/***************************************************************
+ * 函数名称: lcd_span
+ * 说    明: 画一段水平线(包含两端)，坐标可以超出屏幕，超出部分被裁剪
+ * 参    数:
+ *       @x1,x2：起始点和结束点X坐标
+ *       @y：Y坐标
+ *       @color：颜色
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_span(int x1, int x2, int y, uint16_t color)
+{
+    if ((y < 0) || (y >= LCD_H) || (x2 < 0) || (x1 >= LCD_W) || (x2 < x1))
+    {
+        return;
+    }
+    lcd_fill_area((x1 < 0) ? 0 : x1, y, x2, y, color);
+}
+
+/***************************************************************
+ * 函数名称: lcd_isqrt
+ * 说    明: 整数平方根(向下取整)
+ * 参    数:
+ *       @n：被开方数
+ * 返 回 值: 平方根
+ ***************************************************************/
+static uint32_t lcd_isqrt(uint32_t n)
+{
+    uint32_t root = 0;
+    uint32_t bit = 1u << 30;
+
+    while (bit > n)
+    {
+        bit >>= 2;
+    }
+    while (bit != 0)
+    {
+        if (n >= root + bit)
+        {
+            n -= root + bit;
+            root = (root >> 1) + bit;
+        }
+        else
+        {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+
+    return root;
 }
 
+/***************************************************************
+ * 函数名称: lcd_circle_width
+ * 说    明: 圆在距圆心dy行处的半宽，与lcd_draw_circle画出的轮廓一致
+ * 参    数:
+ *       @r：半径
+ *       @dy：到圆心的行距离
+ * 返 回 值: 半宽，dy超出半径时返回-1
+ ***************************************************************/
+static int lcd_circle_width(int r, int dy)
+{
+    if (dy > r)
+    {
+        return -1;
+    }
+    return (int)lcd_isqrt((uint32_t)(r * r - dy * dy));
+}
+
+/***************************************************************
+ * 函数名称: lcd_circle_inner
+ * 说    明: 圆的轮廓在距圆心dy行处最靠近圆心的点的X偏移，
+ *           该行轮廓为[inner, width]两段(左右对称)
+ * 参    数:
+ *       @r：半径
+ *       @dy：到圆心的行距离
+ * 返 回 值: X偏移
+ ***************************************************************/
+static int lcd_circle_inner(int r, int dy)
+{
+    int w = lcd_circle_width(r, dy);
+    int lo = lcd_circle_width(r, dy + 1) + 1;
+
+    return (lo < w) ? lo : w;
+}
+
+/* 0~90度正弦值，放大16384倍 */
+static const int16_t m_lcd_sin_table[91] =
+{
+        0,   286,   572,   857,  1143,  1428,  1713,  1997,  2280,  2563,
+     2845,  3126,  3406,  3686,  3964,  4240,  4516,  4790,  5063,  5334,
+     5604,  5872,  6138,  6402,  6664,  6924,  7182,  7438,  7692,  7943,
+     8192,  8438,  8682,  8923,  9162,  9397,  9630,  9860, 10087, 10311,
+    10531, 10749, 10963, 11174, 11381, 11585, 11786, 11982, 12176, 12365,
+    12551, 12733, 12911, 13085, 13255, 13421, 13583, 13741, 13894, 14044,
+    14189, 14330, 14466, 14598, 14726, 14849, 14968, 15082, 15191, 15296,
+    15396, 15491, 15582, 15668, 15749, 15826, 15897, 15964, 16026, 16083,
+    16135, 16182, 16225, 16262, 16294, 16322, 16344, 16362, 16374, 16382,
+    16384,
+};
+
+static int lcd_sin(int deg)
+{
+    deg %= 360;
+    if (deg < 0)
+    {
+        deg += 360;
+    }
+    if (deg <= 90)
+    {
+        return m_lcd_sin_table[deg];
+    }
+    if (deg <= 180)
+    {
+        return m_lcd_sin_table[180 - deg];
+    }
+    if (deg <= 270)
+    {
+        return -m_lcd_sin_table[deg - 180];
+    }
+    return -m_lcd_sin_table[360 - deg];
+}
+
+
+/* 是否启用抗锯齿字库(由tools/font_subset.py生成)
+ * 0 => 只使用单色点阵
+ * 1 => 24、32号字非叠加方式显示时使用4位灰度点阵，按颜色查表混合
+ */
+#define LCD_ENABLE_FONT_AA  1
+
+#if LCD_ENABLE_FONT_AA
+/* 缓存的前景色/背景色组合个数 */
+#define LCD_AA_LUT_NUM      4
+
+typedef struct
+{
+    uint16_t                fc;             // 前景色
+    uint16_t                bc;             // 背景色
+    uint16_t                lut[16];        // 灰度0~15对应的颜色
+} lcd_aa_lut_t;
+
+static lcd_aa_lut_t m_aa_luts[LCD_AA_LUT_NUM];
+static uint8_t m_aa_lut_count = 0;
+static uint8_t m_aa_lut_next = 0;
+#endif
+
+/***************************************************************
+ * 函数名称: lcd_utf8_decode
+ * 说    明: 3字节utf-8编码转换为unicode编码
+ * 参    数:
+ *       @s：utf-8编码
+ * 返 回 值: unicode编码
+ ***************************************************************/
+static uint16_t lcd_utf8_decode(const uint8_t *s)
+{
+    return ((uint16_t)(s[0] & 0x0F) << 12) | ((uint16_t)(s[1] & 0x3F) << 6) | (s[2] & 0x3F);
+}
+
+/***************************************************************
+ * 函数名称: lcd_font_find
+ * 说    明: 查找字符点阵
+ * 参    数:
+ *       @code：unicode编码
+ *       @sizex：字符宽度
+ *       @sizey：字号
+ *       @aa：返回抗锯齿点阵首地址，该字号没有抗锯齿点阵时为NULL
+ * 返 回 值: 单色点阵首地址，未找到返回NULL
+ ***************************************************************/
+static const uint8_t *lcd_font_find(uint16_t code, uint8_t sizex, uint8_t sizey, const uint8_t **aa)
+{
+    const lcd_font_t *font = NULL;
+    uint16_t lo, hi, mid;
+    uint8_t f;
+
+    for (f = 0; f < lcd_font_num; f++)
+    {
+        if ((lcd_fonts[f].sizex == sizex) && (lcd_fonts[f].sizey == sizey))
+        {
+            font = &lcd_fonts[f];
+            break;
+        }
+    }
+    if (font == NULL)
+    {
+        return NULL;
+    }
+
+    /* 编码从小到大排列，二分查找。字库只含界面用到的字符(每个字号最多几十个)，
+     * 最多比较6次；按编码直接索引需覆盖汉字的编码范围，表比字库本身还大 */
+    lo = 0;
+    hi = font->count;
+    while (lo < hi)
+    {
+        mid = (lo + hi) / 2;
+        if (font->codes[mid] < code)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+    if ((lo == font->count) || (font->codes[lo] != code))
+    {
+        return NULL;
+    }
+
+    *aa = (font->aa == NULL) ? NULL : font->aa + (uint32_t)lo * LCD_AA_GLYPH_SIZE(sizex, sizey);
+    return font->glyphs + (uint32_t)lo * LCD_FONT_GLYPH_SIZE(sizex, sizey);
+}
 
 /***************************************************************
- * 函数名称: lcd_show_chinese_12x12
- * 说    明: 显示单个12x12汉字
+ * 函数名称: lcd_show_glyph
+ * 说    明: 显示一个点阵字符，点阵逐行存放，每行(sizex+7)/8字节，低位在前
  * 参    数:
- *       @x：指定汉字串的起始位置X坐标
- *       @y：指定汉字串的起始位置X坐标
- *       @s：指定汉字串（该汉字串为ascii）
+ *       @x：指定字符的起始位置X坐标
+ *       @y：指定字符的起始位置Y坐标
+ *       @msk：点阵
+ *       @sizex：字符宽度
+ *       @sizey：字符高度
  *       @fc: 字的颜色
  *       @bc: 字的背景色
- *       @sizey: 字号，可选：12
  *       @mode: 0为非叠加模式；1为叠加模式
  * 返 回 值: 无
  ***************************************************************/
-static void lcd_show_chinese_12x12(uint16_t x, uint16_t y, uint8_t *s, uint16_t fc, uint16_t bc, uint8_t sizey, uint8_t mode)
+static void lcd_show_glyph(uint16_t x, uint16_t y, const unsigned char *msk,
+    uint8_t sizex, uint8_t sizey, uint16_t fc, uint16_t bc, uint8_t mode)
 {
-    uint8_t i, j, m=0;
-    uint16_t k;
-    uint16_t HZnum;//汉字数目
-    uint16_t TypefaceNum;//一个字符所占字节大小
-    uint16_t x0 = x;
-    
-    TypefaceNum = (sizey/8+((sizey%8)?1:0)) * sizey;
-
-    /* 统计汉字数目 */
-    HZnum = sizeof(tfont12) / sizeof(typFNT_GB12);
-
-    for (k = 0; k < HZnum; k++) 
-    {
-        if ((tfont12[k].Index[0] == *(s)) && (tfont12[k].Index[1] == *(s+1))
-            && (tfont12[k].Index[2] == *(s+2)))
+    uint8_t bytes = (sizex + 7) / 8;
+    uint8_t row, col, start;
+    const unsigned char *line;
+
+    if (!mode)
+    {/* 非叠加方式 */
+        lcd_win_set(x, y, x+sizex-1, y+sizey-1);
+        for (row = 0; row < sizey; row++)
+        {
+            line = msk + row * bytes;
+            for (col = 0; col < sizex; col++)
+            {
+                lcd_win_pixel((line[col >> 3] & (0x01 << (col & 7))) ? fc : bc);
+            }
+        }
+        lcd_win_end();
+    }
+    else
+    {/* 叠加方式 */
+        for (row = 0; row < sizey; row++)
         {
-            lcd_address_set(x, y, x+sizey-1, y+sizey-1);
-            for (i = 0; i < TypefaceNum; i++)
+            line = msk + row * bytes;
+            col = 0;
+            while (col < sizex)
             {
-                for (j = 0; j < 8; j++)
+                if (!(line[col >> 3] & (0x01 << (col & 7))))
                 {
-                    if (!mode)
-                    {/* 非叠加方式 */
-                        if (tfont12[k].Msk[i] & (0x01<<j))
-                        {
-                            lcd_wr_data(fc);
-                        }
-                        else
-                        {
-                            lcd_wr_data(bc);
-                        }
-                        
-                        m++;
-                        if ((m % sizey) == 0)
-                        {
-                            m = 0;
-                            break;
-                        }
-                    }
-                    else
-                    {/* 叠加方式 */
-                        if (tfont12[k].Msk[i] & (0x01<<j))
-                        {
-                            /* 画一个点 */
-                            lcd_draw_point(x,y,fc);
-                        }
-                        
-                        x++;
-                        if ((x - x0) == sizey)
-                        {
-                            x = x0;
-                            y++;
-                            break;
-                        }
-                    }
+                    col++;
+                    continue;
+                }
+                /* 连续的点合并为一段水平线，整段只设置一次窗口 */
+                start = col;
+                while ((col < sizex) && (line[col >> 3] & (0x01 << (col & 7))))
+                {
+                    col++;
                 }
+                lcd_fill_area(x + start, y + row, x + col - 1, y + row, fc);
             }
-
-            break; //查找到对应点阵字库立即退出，防止多个汉字重复取模带来影响
         }
     }
-} 
+}
+
 
+#if LCD_ENABLE_FONT_AA
 /***************************************************************
- * 函数名称: lcd_show_chinese_16x16
- * 说    明: 显示单个16x16汉字
+ * 函数名称: lcd_aa_lut
+ * 说    明: 获取前景色与背景色按16级灰度混合的颜色表，
+ *           最近用过的几组颜色缓存起来，不用每个字符都计算
  * 参    数:
- *       @x：指定汉字串的起始位置X坐标
- *       @y：指定汉字串的起始位置X坐标
- *       @s：指定汉字串（该汉字串为ascii）
  *       @fc: 字的颜色
  *       @bc: 字的背景色
- *       @sizey: 字号，可选：16
- *       @mode: 0为非叠加模式；1为叠加模式
- * 返 回 值: 无
+ * 返 回 值: 颜色表，下标为灰度
  ***************************************************************/
-static void lcd_show_chinese_16x16(uint16_t x, uint16_t y, uint8_t *s, uint16_t fc, uint16_t bc, uint8_t sizey, uint8_t mode)
+static const uint16_t *lcd_aa_lut(uint16_t fc, uint16_t bc)
 {
-    uint8_t i, j, m = 0;
-    uint16_t k;
-    uint16_t HZnum;//汉字数目
-    uint16_t TypefaceNum;//一个字符所占字节大小
-    uint16_t x0 = x;
-    
-    TypefaceNum = (sizey/8 + ((sizey%8)?1:0)) * sizey;
-    /* 统计汉字数目 */
-    HZnum=sizeof(tfont16) / sizeof(typFNT_GB16);
-    
-    for (k = 0; k < HZnum; k++) 
+    lcd_aa_lut_t *l;
+    uint16_t r, g, b;
+    uint8_t i, a;
+
+    for (i = 0; i < m_aa_lut_count; i++)
     {
-        if ((tfont16[k].Index[0] == *(s)) && (tfont16[k].Index[1] == *(s+1))
-            && (tfont16[k].Index[2] == *(s+2)))
+        if ((m_aa_luts[i].fc == fc) && (m_aa_luts[i].bc == bc))
         {
-            lcd_address_set(x, y, x+sizey-1, y+sizey-1);
-            for (i = 0; i < TypefaceNum; i++)
-            {
-                for (j = 0; j < 8; j++)
-                {
-                    if (!mode)
-                    {/* 非叠加方式 */
-                        if (tfont16[k].Msk[i] & (0x01 << j))
-                        {
-                            lcd_wr_data(fc);
-                        }
-                        else
-                        {
-                            lcd_wr_data(bc);
-                        }
-                        
-                        m++;
-                        if (m%sizey == 0)
-                        {
-                            m = 0;
-                            break;
-                        }
-                    }
-                    else
-                    {/* 叠加方式 */
-                        if (tfont16[k].Msk[i] & (0x01<<j))
-                        {
-                            /* 画一个点 */
-                            lcd_draw_point(x,y,fc);
-                        }
-                        
-                        x++;
-                        if ((x - x0) == sizey)
-                        {
-                            x = x0;
-                            y++;
-                            break;
-                        }
-                    }
-                }
-            }
-
-            break; //查找到对应点阵字库立即退出，防止多个汉字重复取模带来影响
+            return m_aa_luts[i].lut;
         }
     }
-} 
 
+    /* 缓存满后依次替换最早的一组 */
+    l = &m_aa_luts[m_aa_lut_next];
+    m_aa_lut_next = (m_aa_lut_next + 1) % LCD_AA_LUT_NUM;
+    if (m_aa_lut_count < LCD_AA_LUT_NUM)
+    {
+        m_aa_lut_count++;
+    }
+
+    l->fc = fc;
+    l->bc = bc;
+    for (a = 0; a < 16; a++)
+    {
+        r = (((fc >> 11) & 0x1F) * a + ((bc >> 11) & 0x1F) * (15 - a) + 7) / 15;
+        g = (((fc >> 5) & 0x3F) * a + ((bc >> 5) & 0x3F) * (15 - a) + 7) / 15;
+        b = ((fc & 0x1F) * a + (bc & 0x1F) * (15 - a) + 7) / 15;
+        l->lut[a] = (r << 11) | (g << 5) | b;
+    }
+
+    return l->lut;
+}
 
 /***************************************************************
- * 函数名称: lcd_show_chinese_24x24
- * 说    明: 显示单个24x24汉字
+ * 函数名称: lcd_show_glyph_aa
+ * 说    明: 以非叠加方式显示一个4位灰度点阵字符，格式见lcd_font.h，
+ *           每个像素只查一次颜色表
  * 参    数:
- *       @x：指定汉字串的起始位置X坐标
- *       @y：指定汉字串的起始位置X坐标
- *       @s：指定汉字串（该汉字串为ascii）
+ *       @x：指定字符的起始位置X坐标
+ *       @y：指定字符的起始位置Y坐标
+ *       @aa：灰度点阵
+ *       @sizex：字符宽度
+ *       @sizey：字符高度
  *       @fc: 字的颜色
  *       @bc: 字的背景色
- *       @sizey: 字号，可选：24
- *       @mode: 0为非叠加模式；1为叠加模式
  * 返 回 值: 无
  ***************************************************************/
-static void lcd_show_chinese_24x24(uint16_t x, uint16_t y, uint8_t *s, uint16_t fc, uint16_t bc, uint8_t sizey, uint8_t mode)
+static void lcd_show_glyph_aa(uint16_t x, uint16_t y, const uint8_t *aa,
+    uint8_t sizex, uint8_t sizey, uint16_t fc, uint16_t bc)
 {
-    uint8_t i,j,m = 0;
-    uint16_t k;
-    uint16_t HZnum;//汉字数目
-    uint16_t TypefaceNum;//一个字符所占字节大小
-    uint16_t x0 = x;
-    
-    TypefaceNum = (sizey/8 + ((sizey%8)?1:0)) * sizey;
-    /* 统计汉字数目 */
-    HZnum = sizeof(tfont24) / sizeof(typFNT_GB24);
-    
-    for (k = 0; k < HZnum; k++) 
+    const uint16_t *lut = lcd_aa_lut(fc, bc);
+    uint8_t row, col;
+
+    lcd_win_set(x, y, x + sizex - 1, y + sizey - 1);
+    for (row = 0; row < sizey; row++)
     {
-        if ((tfont24[k].Index[0] == *(s)) && (tfont24[k].Index[1] == *(s+1))
-            && (tfont24[k].Index[2] == *(s+2)))
+        for (col = 0; col + 1 < sizex; col += 2)
         {
-            lcd_address_set(x, y, x+sizey-1, y+sizey-1);
-            for (i = 0; i < TypefaceNum; i++)
-            {
-                for (j = 0; j < 8; j++)
-                {
-                    if (!mode)
-                    {/* 非叠加方式 */
-                        if (tfont24[k].Msk[i] & (0x01<<j))
-                        {
-                            lcd_wr_data(fc);
-                        }
-                        else
-                        {
-                            lcd_wr_data(bc);
-                        }
-                        
-                        m++;
-                        if (m%sizey == 0)
-                        {
-                            m = 0;
-                            break;
-                        }
-                    }
-                    else
-                    {/* 叠加方式 */
-                        if (tfont24[k].Msk[i] & (0x01 << j))
-                        {
-                            /* 画一个点 */
-                            lcd_draw_point(x, y, fc);
-                        }
-                        
-                        x++;
-                        if ((x - x0) == sizey)
-                        {
-                            x = x0;
-                            y++;
-                            break;
-                        }
-                    }
-                }
-            }
-
-            break; //查找到对应点阵字库立即退出，防止多个汉字重复取模带来影响
+            lcd_win_pixel(lut[*aa >> 4]);
+            lcd_win_pixel(lut[*aa & 0x0F]);
+            aa++;
+        }
+        if (col < sizex)
+        {
+            lcd_win_pixel(lut[*aa >> 4]);
+            aa++;
         }
     }
-} 
+    lcd_win_end();
+}
+#endif
 
+/* lcd_show_string一次合为一个窗口显示的最多字符数 */
+#define LCD_STRING_RUN      20
 
 /***************************************************************
- * 函数名称: lcd_show_chinese_32x32
- * 说    明: 显示单个32x32汉字
+ * 函数名称: lcd_show_glyph_run
+ * 说    明: 以非叠加方式显示同一行中相邻的n个字符，n个字符合为一个
+ *           窗口逐行写入，只设置一次地址窗口
  * 参    数:
- *       @x：指定汉字串的起始位置X坐标
- *       @y：指定汉字串的起始位置X坐标
- *       @s：指定汉字串（该汉字串为ascii）
+ *       @x：第一个字符的起始位置X坐标
+ *       @y：字符的起始位置Y坐标
+ *       @msk：各字符的点阵
+ *       @aa：各字符的灰度点阵，为NULL时使用点阵
+ *       @n：字符个数
+ *       @sizex：字符宽度
+ *       @sizey：字符高度
  *       @fc: 字的颜色
  *       @bc: 字的背景色
- *       @sizey: 字号，可选：32
- *       @mode: 0为非叠加模式；1为叠加模式
  * 返 回 值: 无
  ***************************************************************/
-static void lcd_show_chinese_32x32(uint16_t x, uint16_t y, uint8_t *s, uint16_t fc, uint16_t bc, uint8_t sizey, uint8_t mode)
+static void lcd_show_glyph_run(uint16_t x, uint16_t y, const unsigned char **msk, const uint8_t **aa,
+    uint8_t n, uint8_t sizex, uint8_t sizey, uint16_t fc, uint16_t bc)
 {
-    uint8_t i,j,m = 0;
-    uint16_t k;
-    uint16_t HZnum;//汉字数目
-    uint16_t TypefaceNum;//一个字符所占字节大小
-    uint16_t x0 = x;
-    
-    TypefaceNum = (sizey/8 + ((sizey%8)?1:0)) * sizey;
-    /* 统计汉字数目 */
-    HZnum = sizeof(tfont32) / sizeof(typFNT_GB32);
-    
-    for (k = 0; k < HZnum; k++)
+    uint8_t bytes = (sizex + 7) / 8;
+    uint8_t row, col, i;
+    const unsigned char *line;
+#if LCD_ENABLE_FONT_AA
+    const uint16_t *lut = lcd_aa_lut(fc, bc);
+    uint8_t aa_bytes = (sizex + 1) / 2;
+#else
+    (void)aa;
+#endif
+
+    lcd_win_set(x, y, x + n * sizex - 1, y + sizey - 1);
+    for (row = 0; row < sizey; row++)
     {
-        if ((tfont32[k].Index[0] == *(s)) && (tfont32[k].Index[1] == *(s+1))
-            && (tfont32[k].Index[2] == *(s+2)))
+        for (i = 0; i < n; i++)
         {
-            lcd_address_set(x, y, x+sizey-1, y+sizey-1);
-            for (i = 0; i < TypefaceNum; i++)
+#if LCD_ENABLE_FONT_AA
+            if (aa[i] != NULL)
             {
-                for (j = 0; j < 8; j++)
+                line = aa[i] + row * aa_bytes;
+                for (col = 0; col < sizex; col++)
                 {
-                    if (!mode)
-                    {/* 非叠加方式 */
-                        if (tfont32[k].Msk[i] & (0x01 << j))
-                        {
-                            lcd_wr_data(fc);
-                        }
-                        else
-                        {
-                            lcd_wr_data(bc);
-                        }
-                        
-                        m++;
-                        if (m%sizey == 0)
-                        {
-                            m = 0;
-                            break;
-                        }
-                    }
-                    else
-                    {/* 叠加方式 */
-                        if (tfont32[k].Msk[i] & (0x01 << j))
-                        {
-                            lcd_draw_point(x, y, fc);//画一个点
-                        }
-                        
-                        x++;
-                        if ((x-x0) == sizey)
-                        {
-                            x = x0;
-                            y++;
-                            break;
-                        }
-                    }
+                    lcd_win_pixel(lut[(col & 1) ? (line[col >> 1] & 0x0F) : (line[col >> 1] >> 4)]);
                 }
+                continue;
+            }
+#endif
+            line = msk[i] + row * bytes;
+            for (col = 0; col < sizex; col++)
+            {
+                lcd_win_pixel((line[col >> 3] & (0x01 << (col & 7))) ? fc : bc);
             }
-
-            break; //查找到对应点阵字库立即退出，防止多个汉字重复取模带来影响
         }
     }
+    lcd_win_end();
 }
 
 
@@ -486,6 +1410,18 @@ unsigned int lcd_init()
     IoTGpioSetDir(LCD_PIN_DC, IOT_GPIO_DIR_OUT);
     IoTGpioSetOutputVal(LCD_PIN_DC, IOT_GPIO_VALUE0);
 
+#if LCD_ENABLE_ASYNC
+    ret = lcd_tx_init();
+    if (ret != 0)
+    {
+        return ret;
+    }
+#endif
+
+    /* 复位后LCD的地址窗口和显示状态恢复为默认值 */
+    m_lcd_win_valid = 0;
+    m_lcd_power = LCD_POWER_ON;
+
     /* 重启lcd */
     LCD_RES_Clr();
     LOS_Msleep(100);
@@ -493,6 +1429,7 @@ unsigned int lcd_init()
     LOS_Msleep(100);
     LOS_Msleep(500);
     lcd_wr_reg(0x11);
+    lcd_sync();
     /* 等待LCD 100ms */
     LOS_Msleep(100);
     /* 启动LCD配置，设置显示和颜色配置 */
@@ -514,7 +1451,7 @@ unsigned int lcd_init()
         lcd_wr_data8(0xA0);
     }
     lcd_wr_reg(0X3A);
-    lcd_wr_data8(0X05);
+    lcd_wr_data8(m_lcd_pixfmt);
     /* ST7789S帧刷屏率设置 */
     lcd_wr_reg(0xb2);
     lcd_wr_data8(0x0c);
@@ -579,6 +1516,11 @@ unsigned int lcd_init()
     lcd_wr_data8(0x20);
     lcd_wr_reg(0x29);
 
+#if LCD_ENABLE_FRAMEBUFFER
+    /* LCD上电后的内容未知，首次刷新时全部发送 */
+    memset(m_lcd_dirty, 0xFF, sizeof(m_lcd_dirty));
+#endif
+
     return 0;
 }
 
@@ -591,6 +1533,7 @@ unsigned int lcd_init()
  ***************************************************************/
 unsigned int lcd_deinit()
 {
+    lcd_sync();
 #if LCD_ENABLE_SPI
     IoTSpiDeinit(LCD_SPI_BUS);
 #else
@@ -605,6 +1548,78 @@ unsigned int lcd_deinit()
 }
 
 
+void lcd_sync(void)
+{
+    lcd_wr_flush();
+#if LCD_ENABLE_ASYNC
+    if (m_lcd_tx_started)
+    {
+        /* 发送任务处理到这一项时，之前的内容都已发送 */
+        lcd_tx_post(LCD_TX_SYNC, 0, NULL, 0, 0);
+        LOS_SemPend(m_lcd_sync_sem, LOS_WAIT_FOREVER);
+    }
+#endif
+}
+
+
+void lcd_stat_get(uint8_t type, lcd_stat_t *stat)
+{
+    memset(stat, 0, sizeof(lcd_stat_t));
+#if LCD_ENABLE_STATS
+    if (type < LCD_STAT_MAX)
+    {
+        *stat = m_lcd_stats[type];
+    }
+#endif
+}
+
+
+void lcd_stat_get_frame(lcd_stat_t *stat)
+{
+#if LCD_ENABLE_STATS
+    *stat = m_lcd_last_frame;
+#else
+    memset(stat, 0, sizeof(lcd_stat_t));
+#endif
+}
+
+
+void lcd_stat_reset(void)
+{
+#if LCD_ENABLE_STATS
+    memset(m_lcd_stats, 0, sizeof(m_lcd_stats));
+#endif
+}
+
+
+void lcd_stat_print(const char *tag)
+{
+#if LCD_ENABLE_STATS
+    static const char *names[LCD_STAT_MAX] =
+    {
+        "other", "fill", "point", "line", "shape", "text", "picture", "flush",
+    };
+    const lcd_stat_t *f = &m_lcd_last_frame;
+    uint8_t i;
+
+    printf("%s frame calls=%u bytes=%u writes=%u win=%u ticks=%u |", tag,
+        f->calls, f->bytes, f->writes, f->windows, f->ticks);
+    /* 各类绘图函数：调用次数/字节数/窗口数/耗时 */
+    for (i = 0; i < LCD_STAT_MAX; i++)
+    {
+        if (m_lcd_stats[i].calls || m_lcd_stats[i].bytes)
+        {
+            printf(" %s %u/%u/%u/%u", names[i], m_lcd_stats[i].calls, m_lcd_stats[i].bytes,
+                m_lcd_stats[i].windows, m_lcd_stats[i].ticks);
+        }
+    }
+    printf("\n");
+#else
+    (void)tag;
+#endif
+}
+
+
 /***************************************************************
  * 函数名称: lcd_fill
  * 说    明: 指定区域填充颜色
@@ -618,18 +1633,295 @@ unsigned int lcd_deinit()
  ***************************************************************/
 void lcd_fill(uint16_t xsta, uint16_t ysta, uint16_t xend, uint16_t yend, uint16_t color)
 {
-    uint16_t i, j;
-
+    LCD_STAT_BEGIN(LCD_STAT_FILL);
     /* 设置显示范围 */
-    lcd_address_set(xsta, ysta, xend-1, yend-1);
+    lcd_win_set(xsta, ysta, xend-1, yend-1);
     /* 填充颜色 */
-    for (i = ysta; i < yend; i++)
+    lcd_win_color(color, (uint32_t)(xend - xsta) * (yend - ysta));
+    lcd_win_end();
+    LCD_STAT_END();
+}
+
+
+#if LCD_ENABLE_FRAMEBUFFER
+/***************************************************************
+ * 函数名称: lcd_fb_blit
+ * 说    明: 刷新时把图片整个窗口直接从flash发送，并清除完全在图片内的
+ *           区块的变化标志；这些区块中有变化的不到图片的一半时不发送，
+ *           由区块刷新只发送有变化的部分
+ * 参    数:
+ *       @b：图片
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_fb_blit(const lcd_blit_t *b)
+{
+    uint16_t c1, c2, r1, r2, row;
+    uint32_t bits, mask, area, dirty = 0;
+
+    /* 完全在图片内的区块：列c1~c2-1，行r1~r2-1 */
+    c1 = (b->x1 + LCD_TILE_SIZE - 1) / LCD_TILE_SIZE;
+    c2 = (b->x2 + 1) / LCD_TILE_SIZE;
+    r1 = (b->y1 + LCD_TILE_SIZE - 1) / LCD_TILE_SIZE;
+    r2 = (b->y2 + 1) / LCD_TILE_SIZE;
+    if ((c1 >= c2) || (r1 >= r2))
     {
-        for (j = xsta; j < xend; j++)
+        return;
+    }
+
+    bits = (1u << c2) - (1u << c1);
+    for (row = r1; row < r2; row++)
+    {
+        for (mask = m_lcd_dirty[row] & bits; mask != 0; mask &= mask - 1)
+        {
+            dirty++;
+        }
+    }
+    area = (uint32_t)(b->x2 - b->x1 + 1) * (b->y2 - b->y1 + 1);
+    if (dirty * LCD_TILE_SIZE * LCD_TILE_SIZE * 2 < area)
+    {
+        return;
+    }
+
+    lcd_address_set(b->x1, b->y1, b->x2, b->y2);
+    lcd_wr_ext(b->dat, area * 2);
+    for (row = r1; row < r2; row++)
+    {
+        m_lcd_dirty[row] &= ~bits;
+        m_lcd_lossy[row] &= ~bits;
+    }
+}
+
+/***************************************************************
+ * 函数名称: lcd_fb_flush
+ * 说    明: 将显存中有变化的区块发送到LCD
+ * 参    数: 无
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_fb_flush(void)
+{
+    uint16_t row, col, end, x, y, x2, y2;
+    uint32_t mask, bits;
+    uint8_t lossy, i;
+
+    /* 先从flash发送图片，图片内的区块不再从显存发送 */
+    if (m_lcd_pixfmt == LCD_PIXEL_RGB565)
+    {
+        for (i = 0; i < m_lcd_blit_num; i++)
+        {
+            lcd_fb_blit(&m_lcd_blits[i]);
+        }
+    }
+    m_lcd_blit_num = 0;
+
+    for (row = 0; row < LCD_TILE_ROWS; row++)
+    {
+        mask = m_lcd_dirty[row] & ((1u << LCD_TILE_COLS) - 1);
+        m_lcd_dirty[row] = 0;
+        col = 0;
+        while (mask != 0)
+        {
+            /* 找出连续的一段变化区块，合并为一个窗口发送 */
+            while ((mask & (1u << col)) == 0)
+            {
+                col++;
+            }
+            end = col;
+            while ((end < LCD_TILE_COLS) && (mask & (1u << end)))
+            {
+                mask &= ~(1u << end);
+                end++;
+            }
+
+            bits = (1u << end) - (1u << col);
+
+            x = col * LCD_TILE_SIZE;
+            x2 = end * LCD_TILE_SIZE;
+            y2 = (row + 1) * LCD_TILE_SIZE;
+            x2 = (x2 > LCD_W) ? LCD_W : x2;
+            y2 = (y2 > LCD_H) ? LCD_H : y2;
+            lcd_address_set(x, row * LCD_TILE_SIZE, x2 - 1, y2 - 1);
+            lossy = 0;
+            for (y = row * LCD_TILE_SIZE; y < y2; y++)
+            {
+                for (x = col * LCD_TILE_SIZE; x < x2; x++)
+                {
+                    lcd_wr_pixel(m_lcd_fb[y][x]);
+                    if ((m_lcd_pixfmt == LCD_PIXEL_RGB444) &&
+                        (LCD_RGB444_TO_565(LCD_RGB444(m_lcd_fb[y][x])) != m_lcd_fb[y][x]))
+                    {
+                        lossy = 1;
+                    }
+                }
+            }
+            if (lossy)
+            {
+                m_lcd_lossy[row] |= bits;
+            }
+            else
+            {
+                m_lcd_lossy[row] &= ~bits;
+            }
+            col = end;
+        }
+    }
+    lcd_wr_end();
+}
+#endif
+
+
+/***************************************************************
+ * 函数名称: lcd_flush
+ * 说    明: 将显存中有变化的区块发送到LCD
+ * 参    数: 无
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_flush(void)
+{
+    LCD_STAT_BEGIN(LCD_STAT_FLUSH);
+#if LCD_ENABLE_FRAMEBUFFER
+    lcd_fb_flush();
+#endif
+    LCD_STAT_END();
+
+#if LCD_ENABLE_STATS
+    /* 每次刷新作为一帧的结束 */
+    m_lcd_last_frame = m_lcd_frame;
+    memset(&m_lcd_frame, 0, sizeof(m_lcd_frame));
+#endif
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_set_pixel_format
+ * 说    明: 设置之后发送的像素格式(0x3A)
+ * 参    数:
+ *       @format：LCD_PIXEL_RGB565或LCD_PIXEL_RGB444
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_set_pixel_format(uint8_t format)
+{
+#if LCD_ENABLE_FRAMEBUFFER
+    uint16_t row;
+#endif
+
+    if (format != LCD_PIXEL_RGB444)
+    {
+        format = LCD_PIXEL_RGB565;
+    }
+    if (format == m_lcd_pixfmt)
+    {
+        return;
+    }
+
+#if LCD_ENABLE_FRAMEBUFFER
+    if (format == LCD_PIXEL_RGB565)
+    {
+        /* 以RGB444发送时有损失的区块在下次刷新时以RGB565重新发送 */
+        for (row = 0; row < LCD_TILE_ROWS; row++)
         {
-            lcd_wr_data(color);
+            m_lcd_dirty[row] |= m_lcd_lossy[row];
         }
     }
+#endif
+
+    lcd_wr_reg(0x3A);
+    lcd_wr_data8(format);
+    m_lcd_pixfmt = format;
+}
+
+
+void lcd_set_power(uint8_t mode)
+{
+    if ((mode > LCD_POWER_SLEEP) || (mode == m_lcd_power))
+    {
+        return;
+    }
+
+    LCD_STAT_BEGIN(LCD_STAT_OTHER);
+    if (mode == LCD_POWER_SLEEP)
+    {
+        /* 先关闭显示，避免休眠过程中屏幕闪烁 */
+        lcd_wr_reg(0x28);
+        lcd_wr_reg(0x10);
+        lcd_wr_flush();
+        m_lcd_power = mode;
+        LCD_STAT_END();
+        return;
+    }
+
+    if (m_lcd_power == LCD_POWER_SLEEP)
+    {
+        /* 退出休眠后需等待5ms才能发送下一个命令 */
+        lcd_wr_reg(0x11);
+        lcd_sync();
+        LOS_Msleep(5);
+        lcd_wr_reg(0x29);
+    }
+    /* 亮度控制(0x53)：BCTRL和BL置1后0x51设置的亮度生效 */
+    lcd_wr_reg(0x53);
+    lcd_wr_data8(0x24);
+    lcd_wr_reg(0x51);
+    lcd_wr_data8((mode == LCD_POWER_DIM) ? LCD_DIM_BRIGHTNESS : 0xFF);
+    lcd_wr_flush();
+    m_lcd_power = mode;
+    LCD_STAT_END();
+}
+
+
+void lcd_scroll_area(uint16_t start, uint16_t len)
+{
+    uint16_t tfa, bfa;
+
+    if ((len == 0) || (start >= LCD_SCROLL_LINES))
+    {
+        return;
+    }
+    if (start + len > LCD_SCROLL_LINES)
+    {
+        len = LCD_SCROLL_LINES - start;
+    }
+    m_lcd_scroll_start = start;
+    m_lcd_scroll_len = len;
+
+    /* 显存行与屏幕坐标反向时，屏幕上方的固定区对应显存下方 */
+    tfa = LCD_SCROLL_MIRROR ? (LCD_SCROLL_LINES - start - len) : start;
+    bfa = LCD_SCROLL_LINES - tfa - len;
+
+    LCD_STAT_BEGIN(LCD_STAT_OTHER);
+    lcd_wr_reg(0x33);
+    lcd_wr_data(tfa);
+    lcd_wr_data(len);
+    lcd_wr_data(bfa);
+    lcd_wr_flush();
+    LCD_STAT_END();
+}
+
+
+void lcd_scroll_start(uint16_t offset)
+{
+    uint16_t start, len, vsp;
+
+    start = m_lcd_scroll_start;
+    len = m_lcd_scroll_len;
+    offset %= len;
+    if (LCD_SCROLL_MIRROR)
+    {
+        vsp = (LCD_SCROLL_LINES - start - len) + (len - offset) % len;
+    }
+    else
+    {
+        vsp = start + offset;
+    }
+
+    LCD_STAT_BEGIN(LCD_STAT_OTHER);
+#if LCD_ENABLE_FRAMEBUFFER
+    /* 先把滚动区中新画的内容发出去，再移动显示起点 */
+    lcd_fb_flush();
+#endif
+    lcd_wr_reg(0x37);
+    lcd_wr_data(vsp);
+    lcd_wr_flush();
+    LCD_STAT_END();
 }
 
 
@@ -644,9 +1936,56 @@ void lcd_fill(uint16_t xsta, uint16_t ysta, uint16_t xend, uint16_t yend, uint16
  ***************************************************************/
 void lcd_draw_point(uint16_t x, uint16_t y, uint16_t color)
 {
+    LCD_STAT_BEGIN(LCD_STAT_POINT);
     /* 设置光标位置 */
-    lcd_address_set(x, y, x, y);
-    lcd_wr_data(color);
+    lcd_win_set(x, y, x, y);
+    lcd_win_pixel(color);
+    lcd_win_end();
+    LCD_STAT_END();
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_draw_hline
+ * 说    明: 指定位置画一条水平线
+ * 参    数:
+ *       @x：指定线的起始点X坐标
+ *       @y：指定线的Y坐标
+ *       @len：指定线的长度
+ *       @color：指定线的颜色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_draw_hline(uint16_t x, uint16_t y, uint16_t len, uint16_t color)
+{
+    if (len == 0)
+    {
+        return;
+    }
+    LCD_STAT_BEGIN(LCD_STAT_LINE);
+    lcd_fill_area(x, y, x + len - 1, y, color);
+    LCD_STAT_END();
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_draw_vline
+ * 说    明: 指定位置画一条垂直线
+ * 参    数:
+ *       @x：指定线的X坐标
+ *       @y：指定线的起始点Y坐标
+ *       @len：指定线的长度
+ *       @color：指定线的颜色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_draw_vline(uint16_t x, uint16_t y, uint16_t len, uint16_t color)
+{
+    if (len == 0)
+    {
+        return;
+    }
+    LCD_STAT_BEGIN(LCD_STAT_LINE);
+    lcd_fill_area(x, y, x, y + len - 1, color);
+    LCD_STAT_END();
 }
 
 
@@ -663,6 +2002,18 @@ void lcd_draw_point(uint16_t x, uint16_t y, uint16_t color)
  ***************************************************************/
 void lcd_draw_line(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color)
 {
+    /* 水平线和垂直线用一个窗口整段发送 */
+    if (y1 == y2)
+    {
+        lcd_draw_hline((x1 < x2) ? x1 : x2, y1, ((x1 < x2) ? (x2 - x1) : (x1 - x2)) + 1, color);
+        return;
+    }
+    if (x1 == x2)
+    {
+        lcd_draw_vline(x1, (y1 < y2) ? y1 : y2, ((y1 < y2) ? (y2 - y1) : (y1 - y2)) + 1, color);
+        return;
+    }
+
     uint16_t t; 
     int xerr=0, yerr=0, delta_x, delta_y, distance;
     int incx, incy, uRow, uCol;
@@ -715,6 +2066,7 @@ void lcd_draw_line(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t
         distance = delta_y;
     }
     
+    LCD_STAT_BEGIN(LCD_STAT_LINE);
     for (t = 0; t < distance+1; t++)
     {
         /* 画点 */
@@ -732,6 +2084,7 @@ void lcd_draw_line(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t
             uCol += incy;
         }
     }
+    LCD_STAT_END();
 }
 
 
@@ -748,10 +2101,32 @@ void lcd_draw_line(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t
  ***************************************************************/
 void lcd_draw_rectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2,uint16_t color)
 {
+    LCD_STAT_BEGIN(LCD_STAT_SHAPE);
     lcd_draw_line(x1, y1, x2, y1, color);
     lcd_draw_line(x1, y1, x1, y2, color);
     lcd_draw_line(x1, y2, x2, y2, color);
     lcd_draw_line(x2, y1, x2, y2, color);
+    LCD_STAT_END();
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_fill_rectangle
+ * 说    明: 指定位置画实心矩形
+ * 参    数:
+ *       @x1：指定矩形的起始点X坐标
+ *       @y1：指定矩形的起始点Y坐标
+ *       @x2：指定矩形的结束点X坐标
+ *       @y2：指定矩形的结束点Y坐标
+ *       @color：指定矩形的颜色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_fill_rectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color)
+{
+    LCD_STAT_BEGIN(LCD_STAT_FILL);
+    lcd_fill_area((x1 < x2) ? x1 : x2, (y1 < y2) ? y1 : y2,
+        (x1 < x2) ? x2 : x1, (y1 < y2) ? y2 : y1, color);
+    LCD_STAT_END();
 }
 
 
@@ -767,37 +2142,306 @@ void lcd_draw_rectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2,uint1
  ***************************************************************/
 void lcd_draw_circle(uint16_t x0, uint16_t y0, uint8_t r, uint16_t color)
 {
-    int a, b;
-    
-    a = 0;
-    b = r;
-    
-    while (a <= b)
-    {
-        lcd_draw_point(x0-b, y0-a, color);
-        lcd_draw_point(x0+b, y0-a, color);
-        lcd_draw_point(x0-a, y0+b, color);
-        lcd_draw_point(x0-a, y0-b, color);
-        lcd_draw_point(x0+b, y0+a, color);
-        lcd_draw_point(x0+a, y0-b, color);
-        lcd_draw_point(x0+a, y0+b, color);
-        lcd_draw_point(x0-b, y0+a, color);
-        a++;
-        /* 判断要画的点是否过远 */
-        if ((a*a+b*b) > (r*r))
+    int dy, w, lo;
+
+    LCD_STAT_BEGIN(LCD_STAT_SHAPE);
+    /* 每行的轮廓是两段连续的点，从本行半宽到下一行半宽之间 */
+    for (dy = 0; dy <= r; dy++)
+    {
+        w = lcd_circle_width(r, dy);
+        lo = lcd_circle_inner(r, dy);
+        if (lo == 0)
+        {
+            lcd_span(x0 - w, x0 + w, y0 - dy, color);
+            if (dy != 0)
+            {
+                lcd_span(x0 - w, x0 + w, y0 + dy, color);
+            }
+            continue;
+        }
+        lcd_span(x0 - w, x0 - lo, y0 - dy, color);
+        lcd_span(x0 + lo, x0 + w, y0 - dy, color);
+        if (dy != 0)
         {
-            b--;
+            lcd_span(x0 - w, x0 - lo, y0 + dy, color);
+            lcd_span(x0 + lo, x0 + w, y0 + dy, color);
         }
     }
+    LCD_STAT_END();
 }
 /* 三角形*/
 void lcd_draw_triangle(uint16_t x0, uint16_t y0,uint16_t x1, uint16_t y1,uint16_t x2, uint16_t y2,  uint16_t color){
 
+    LCD_STAT_BEGIN(LCD_STAT_SHAPE);
     lcd_draw_line(x0, y0, x1, y1, color);
     lcd_draw_line(x1, y1, x2, y2, color);
     lcd_draw_line(x2, y2, x0, y0, color);
+    LCD_STAT_END();
+
+
+}
+
+
+void lcd_fill_circle(uint16_t x0, uint16_t y0, uint8_t r, uint16_t color)
+{
+    int dy, w;
+
+    LCD_STAT_BEGIN(LCD_STAT_SHAPE);
+    for (dy = 0; dy <= r; dy++)
+    {
+        w = lcd_circle_width(r, dy);
+        lcd_span(x0 - w, x0 + w, y0 - dy, color);
+        if (dy != 0)
+        {
+            lcd_span(x0 - w, x0 + w, y0 + dy, color);
+        }
+    }
+    LCD_STAT_END();
+}
+
+
+void lcd_fill_triangle(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color)
+{
+    int ax = x0, ay = y0, bx = x1, by = y1, cx = x2, cy = y2;
+    int t, y, xa, xb;
+
+    /* 按Y坐标从小到大排序顶点 */
+    if (ay > by)
+    {
+        t = ax; ax = bx; bx = t;
+        t = ay; ay = by; by = t;
+    }
+    if (by > cy)
+    {
+        t = bx; bx = cx; cx = t;
+        t = by; by = cy; cy = t;
+    }
+    if (ay > by)
+    {
+        t = ax; ax = bx; bx = t;
+        t = ay; ay = by; by = t;
+    }
+
+    LCD_STAT_BEGIN(LCD_STAT_SHAPE);
+    if (ay == cy)
+    {
+        /* 三点在同一行 */
+        xa = (ax < bx) ? ax : bx;
+        xa = (xa < cx) ? xa : cx;
+        xb = (ax > bx) ? ax : bx;
+        xb = (xb > cx) ? xb : cx;
+        lcd_span(xa, xb, ay, color);
+        LCD_STAT_END();
+        return;
+    }
+
+    /* 每行求出长边(a-c)和短边(a-b或b-c)上的X坐标，之间画一段水平线 */
+    for (y = ay; y <= cy; y++)
+    {
+        xa = ax + (cx - ax) * (y - ay) / (cy - ay);
+        if (y < by)
+        {
+            xb = ax + (bx - ax) * (y - ay) / (by - ay);
+        }
+        else if (cy != by)
+        {
+            xb = bx + (cx - bx) * (y - by) / (cy - by);
+        }
+        else
+        {
+            xb = bx;
+        }
+        if (xa > xb)
+        {
+            t = xa; xa = xb; xb = t;
+        }
+        lcd_span(xa, xb, y, color);
+    }
+    LCD_STAT_END();
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_round_rect_radius
+ * 说    明: 限制圆角半径不超过矩形宽高的一半，并整理坐标顺序
+ * 参    数:
+ *       @x1,y1,x2,y2：矩形坐标，返回整理后的坐标
+ *       @r：圆角半径
+ * 返 回 值: 实际使用的圆角半径
+ ***************************************************************/
+static int lcd_round_rect_radius(uint16_t *x1, uint16_t *y1, uint16_t *x2, uint16_t *y2, uint8_t r)
+{
+    uint16_t t;
+    int max;
+
+    if (*x1 > *x2)
+    {
+        t = *x1; *x1 = *x2; *x2 = t;
+    }
+    if (*y1 > *y2)
+    {
+        t = *y1; *y1 = *y2; *y2 = t;
+    }
+    max = ((*x2 - *x1) < (*y2 - *y1)) ? (*x2 - *x1) : (*y2 - *y1);
+    max /= 2;
+
+    return (r > max) ? max : r;
+}
+
+
+void lcd_draw_round_rect(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint8_t r, uint16_t color)
+{
+    int rr, dy, w, lo;
+    int cx1, cx2, cy1, cy2;
+
+    rr = lcd_round_rect_radius(&x1, &y1, &x2, &y2, r);
+    /* 四个圆角的圆心 */
+    cx1 = x1 + rr;
+    cx2 = x2 - rr;
+    cy1 = y1 + rr;
+    cy2 = y2 - rr;
+
+    LCD_STAT_BEGIN(LCD_STAT_SHAPE);
+    /* 四条边只画圆角之间的部分 */
+    lcd_span(cx1 + 1, cx2 - 1, y1, color);
+    lcd_span(cx1 + 1, cx2 - 1, y2, color);
+    for (dy = cy1 + 1; dy < cy2; dy++)
+    {
+        lcd_span(x1, x1, dy, color);
+        lcd_span(x2, x2, dy, color);
+    }
+    /* 圆角与lcd_draw_circle的轮廓一致，每行两端各一段 */
+    for (dy = 0; dy <= rr; dy++)
+    {
+        w = lcd_circle_width(rr, dy);
+        lo = lcd_circle_inner(rr, dy);
+        lcd_span(cx1 - w, cx1 - lo, cy1 - dy, color);
+        lcd_span(cx2 + lo, cx2 + w, cy1 - dy, color);
+        lcd_span(cx1 - w, cx1 - lo, cy2 + dy, color);
+        lcd_span(cx2 + lo, cx2 + w, cy2 + dy, color);
+    }
+    LCD_STAT_END();
+}
+
+
+void lcd_fill_round_rect(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint8_t r, uint16_t color)
+{
+    int rr, dy, w;
+
+    rr = lcd_round_rect_radius(&x1, &y1, &x2, &y2, r);
+
+    LCD_STAT_BEGIN(LCD_STAT_SHAPE);
+    for (dy = rr; dy > 0; dy--)
+    {
+        w = lcd_circle_width(rr, dy);
+        lcd_span(x1 + rr - w, x2 - rr + w, y1 + rr - dy, color);
+        lcd_span(x1 + rr - w, x2 - rr + w, y2 - rr + dy, color);
+    }
+    /* 中间部分是一个矩形，用一个窗口填充 */
+    lcd_fill_area(x1, y1 + rr, x2, y2 - rr, color);
+    LCD_STAT_END();
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_arc_span
+ * 说    明: 画圆弧中的一段水平线，只画角度范围内的点，
+ *           连续的点合并为一段发送
+ * 参    数:
+ *       @x0,y0：圆心坐标
+ *       @dx1,dx2：相对圆心的起始和结束X偏移
+ *       @dy：相对圆心的Y偏移(向下为正)
+ *       @sx,sy,ex,ey：起始和结束角度的方向向量(数学坐标系)
+ *       @wide：角度范围是否超过180度
+ *       @color：颜色
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_arc_span(int x0, int y0, int dx1, int dx2, int dy,
+    int sx, int sy, int ex, int ey, uint8_t wide, uint16_t color)
+{
+    int dx, start = 0;
+    uint8_t in, run = 0;
+    int py = -dy;
+
+    for (dx = dx1; dx <= dx2 + 1; dx++)
+    {
+        in = 0;
+        if (dx <= dx2)
+        {
+            /* 叉积判断点是否在起始方向的顺时针一侧、结束方向的逆时针一侧 */
+            uint8_t after_start = ((sx * py - sy * dx) <= 0);
+            uint8_t before_end = ((ex * py - ey * dx) >= 0);
+
+            in = wide ? (after_start || before_end) : (after_start && before_end);
+        }
+        if (in && !run)
+        {
+            start = dx;
+            run = 1;
+        }
+        else if (!in && run)
+        {
+            lcd_span(x0 + start, x0 + dx - 1, y0 + dy, color);
+            run = 0;
+        }
+    }
+}
+
+
+void lcd_draw_arc(uint16_t x0, uint16_t y0, uint8_t r, uint8_t thickness,
+    uint16_t start, uint16_t end, uint16_t color)
+{
+    int sweep, dy, ady, w, lo, r_in;
+    int sx, sy, ex, ey;
+    uint8_t wide, full;
 
+    if ((thickness == 0) || (start == end))
+    {
+        return;
+    }
+
+    /* 角度以12点方向为0度，顺时针增加 */
+    full = (end >= start + 360);
+    sweep = ((int)end - (int)start) % 360;
+    sweep = (sweep < 0) ? (sweep + 360) : sweep;
+    wide = (sweep > 180);
+    sx = lcd_sin(start);
+    sy = lcd_sin(start + 90);
+    ex = lcd_sin(end);
+    ey = lcd_sin(end + 90);
+    r_in = (int)r - thickness + 1;
+
+    LCD_STAT_BEGIN(LCD_STAT_SHAPE);
+    for (dy = -r; dy <= r; dy++)
+    {
+        ady = (dy < 0) ? -dy : dy;
+        w = lcd_circle_width(r, ady);
+        /* 圆环由半径r_in~r的圆的轮廓组成，内边取最小那个圆的轮廓内边 */
+        lo = (ady <= r_in) ? lcd_circle_inner(r_in, ady) : 0;
 
+        if (full)
+        {
+            if (lo == 0)
+            {
+                lcd_span(x0 - w, x0 + w, y0 + dy, color);
+            }
+            else
+            {
+                lcd_span(x0 - w, x0 - lo, y0 + dy, color);
+                lcd_span(x0 + lo, x0 + w, y0 + dy, color);
+            }
+        }
+        else if (lo == 0)
+        {
+            lcd_arc_span(x0, y0, -w, w, dy, sx, sy, ex, ey, wide, color);
+        }
+        else
+        {
+            lcd_arc_span(x0, y0, -w, -lo, dy, sx, sy, ex, ey, wide, color);
+            lcd_arc_span(x0, y0, lo, w, dy, sx, sy, ex, ey, wide, color);
+        }
+    }
+    LCD_STAT_END();
 }
 
 
@@ -817,38 +2461,27 @@ void lcd_draw_triangle(uint16_t x0, uint16_t y0,uint16_t x1, uint16_t y1,uint16_
 void lcd_show_chinese(uint16_t x, uint16_t y, uint8_t *s, 
     uint16_t fc, uint16_t bc, uint8_t sizey, uint8_t mode)
 {
-    // uint8_t buffer[128];
-    // uint32_t buffer_len = 0;
-    // uint32_t len = strlen(s);
-
-    // memset(buffer, 0, sizeof(buffer));
-    // /* utf8格式汉字转化为ascii格式 */
-    // chinese_utf8_to_ascii(s, strlen(s), buffer, &buffer_len);
+    const unsigned char *msk;
+    const uint8_t *aa;
 
-    for (uint32_t i = 0; i < strlen(s); i += 3, x += sizey)
+    LCD_STAT_BEGIN(LCD_STAT_TEXT);
+    for (uint32_t i = 0; i < strlen((char *)s); i += 3, x += sizey)
     {
-        if (sizey == 12)
-        {
-            lcd_show_chinese_12x12(x, y, &s[i], fc, bc, sizey, mode);
-        }
-        else if (sizey == 16)
-        {
-            lcd_show_chinese_16x16(x, y, &s[i], fc, bc, sizey, mode);
-        }
-        else if (sizey == 24)
-        {
-            lcd_show_chinese_24x24(x, y, &s[i], fc, bc, sizey, mode);
-        }
-        else if (sizey == 32)
+        msk = lcd_font_find(lcd_utf8_decode(&s[i]), sizey, sizey, &aa);
+        if (msk == NULL)
         {
-            lcd_show_chinese_32x32(x, y, &s[i], fc, bc, sizey, mode);
+            continue;
         }
-        else
+#if LCD_ENABLE_FONT_AA
+        if ((aa != NULL) && !mode)
         {
-            return;
+            lcd_show_glyph_aa(x, y, aa, sizey, sizey, fc, bc);
+            continue;
         }
+#endif
+        lcd_show_glyph(x, y, msk, sizey, sizey, fc, bc, mode);
     }
-
+    LCD_STAT_END();
 }
 
 
@@ -868,84 +2501,31 @@ void lcd_show_chinese(uint16_t x, uint16_t y, uint8_t *s,
  ***************************************************************/
 void lcd_show_char(uint16_t x, uint16_t y, uint8_t num, uint16_t fc, uint16_t bc, uint8_t sizey, uint8_t mode)
 {
-    uint8_t temp,sizex,t,m = 0;
-    uint16_t i;
-    uint16_t TypefaceNum;//一个字符所占字节大小
-    uint16_t x0 = x;
-    
-    sizex = sizey/2;
-    TypefaceNum = (sizex/8 + ((sizex%8)?1:0)) * sizey;
+    uint8_t sizex = sizey / 2;
+    const unsigned char *msk;
+    const uint8_t *aa = NULL;
 
-    /* 得到偏移后的值 */
-    num = num-' ';
-    /* 设置光标位置 */
-    lcd_address_set(x, y, x+sizex-1, y+sizey-1);
-    
-    for (i = 0; i < TypefaceNum; i++)
-    { 
-        if (sizey == 12)
-        {
-            /* 调用6x12字体 */
-            temp = ascii_1206[num][i];
-        }
-        else if (sizey == 16)
-        {
-            /* 调用8x16字体 */
-            temp = ascii_1608[num][i];
-        }
-        else if (sizey == 24)
-        {
-            /* 调用12x24字体 */
-            temp = ascii_2412[num][i];
-        }
-        else if (sizey == 32)
-        {
-            /* 调用16x32字体 */
-            temp = ascii_3216[num][i];
-        }
-        else
-        {
-            return;
-        }
-        
-        for (t = 0; t < 8; t++)
-        {
-            if (!mode)
-            {/* 非叠加模式 */
-                if (temp & (0x01 << t))
-                {
-                    lcd_wr_data(fc);
-                }
-                else
-                {
-                    lcd_wr_data(bc);
-                }
-                
-                m++;
-                if (m%sizex == 0)
-                {
-                    m = 0;
-                    break;
-                }
-            }
-            else
-            {/* 叠加模式 */
-                if (temp & (0x01 << t))
-                {
-                    /* 画一个点 */
-                    lcd_draw_point(x, y, fc);
-                }
-                
-                x++;
-                if ((x - x0) == sizex)
-                {
-                    x = x0;
-                    y++;
-                    break;
-                }
-            }
-        }
-    }   	 	  
+    /* 字库中只有界面用到的字符，没有的字符不显示 */
+    msk = lcd_font_find(num, sizex, sizey, &aa);
+    if (msk == NULL)
+    {
+        return;
+    }
+
+    LCD_STAT_BEGIN(LCD_STAT_TEXT);
+#if LCD_ENABLE_FONT_AA
+    if ((aa != NULL) && !mode)
+    {
+        lcd_show_glyph_aa(x, y, aa, sizex, sizey, fc, bc);
+    }
+    else
+#else
+    (void)aa;
+#endif
+    {
+        lcd_show_glyph(x, y, msk, sizex, sizey, fc, bc, mode);
+    }
+    LCD_STAT_END();
 }
 
 
@@ -963,13 +2543,88 @@ void lcd_show_char(uint16_t x, uint16_t y, uint8_t num, uint16_t fc, uint16_t bc
  * 返 回 值: 无
  ***************************************************************/
 void lcd_show_string(uint16_t x, uint16_t y, const uint8_t *p, uint16_t fc, uint16_t bc, uint8_t sizey, uint8_t mode)
-{         
+{
+    uint8_t sizex = sizey / 2;
+    const unsigned char *msk[LCD_STRING_RUN];
+    const uint8_t *aa[LCD_STRING_RUN];
+    uint8_t n;
+
+    LCD_STAT_BEGIN(LCD_STAT_TEXT);
     while (*p != '\0')
-    {       
-        lcd_show_char(x, y, *p, fc, bc, sizey, mode);
-        x += (sizey / 2);
-        p++;
-    }  
+    {
+        if (mode)
+        {
+            lcd_show_char(x, y, *p, fc, bc, sizey, mode);
+            x += sizex;
+            p++;
+            continue;
+        }
+
+        /* 相邻的字符合为一个窗口，不超出屏幕右边 */
+        for (n = 0; (n < LCD_STRING_RUN) && (p[n] != '\0'); n++)
+        {
+            if ((n > 0) && (x + (n + 1) * sizex > LCD_W))
+            {
+                break;
+            }
+            msk[n] = lcd_font_find(p[n], sizex, sizey, &aa[n]);
+            if (msk[n] == NULL)
+            {
+                break;
+            }
+        }
+        if (n == 0)
+        {
+            /* 字库中没有的字符不显示 */
+            x += sizex;
+            p++;
+            continue;
+        }
+        lcd_show_glyph_run(x, y, msk, aa, n, sizex, sizey, fc, bc);
+        x += n * sizex;
+        p += n;
+    }
+    LCD_STAT_END();
+}
+
+
+void lcd_format_int(char *buf, uint32_t num, uint8_t len)
+{
+    int8_t i;
+
+    len = (len > LCD_NUM_MAX) ? LCD_NUM_MAX : len;
+    buf[len] = '\0';
+    /* 从低位到高位取出len位数字，只用除10和取余 */
+    for (i = len - 1; i >= 0; i--)
+    {
+        buf[i] = '0' + (num % 10);
+        num /= 10;
+    }
+    /* 高位的0显示为空格，个位总是显示 */
+    for (i = 0; (i < len - 1) && (buf[i] == '0'); i++)
+    {
+        buf[i] = ' ';
+    }
+}
+
+
+void lcd_format_fixed(char *buf, uint32_t num, uint8_t len)
+{
+    int8_t i;
+
+    len = (len > LCD_NUM_MAX) ? LCD_NUM_MAX : len;
+    /* 从低位到高位依次取出len位数字，并在最后两位前插入小数点 */
+    buf[len + 1] = '\0';
+    for (i = len; i >= 0; i--)
+    {
+        if (i == len - 2)
+        {
+            buf[i] = '.';
+            continue;
+        }
+        buf[i] = '0' + (num % 10);
+        num /= 10;
+    }
 }
 
 
@@ -987,28 +2642,11 @@ void lcd_show_string(uint16_t x, uint16_t y, const uint8_t *p, uint16_t fc, uint
  ***************************************************************/
 void lcd_show_int_num(uint16_t x, uint16_t y, uint16_t num, uint8_t len, uint16_t fc, uint16_t bc, uint8_t sizey)
 {
-    uint8_t t,temp;
-    uint8_t enshow=0;
-    uint8_t sizex = sizey / 2;
-    
-    for (t=0; t<len; t++)
-    {
-        temp = (num/mypow(10,len-t-1)) % 10;
-        if (enshow==0 && t<(len-1))
-        {
-            if (temp == 0)
-            {
-                lcd_show_char(x+t*sizex, y, ' ', fc, bc, sizey, 0);
-                continue;
-            }
-            else
-            {
-                enshow = 1;
-            }
-        }
-        lcd_show_char(x+t*sizex, y, temp+48, fc, bc, sizey, 0);
-    }
-} 
+    char buf[LCD_NUM_MAX + 1];
+
+    lcd_format_int(buf, num, len);
+    lcd_show_string(x, y, (const uint8_t *)buf, fc, bc, sizey, 0);
+}
 
 
 /***************************************************************
@@ -1025,22 +2663,12 @@ void lcd_show_int_num(uint16_t x, uint16_t y, uint16_t num, uint8_t len, uint16_
  ***************************************************************/
 void lcd_show_float_num1(uint16_t x, uint16_t y,float num,uint8_t len,uint16_t fc,uint16_t bc,uint8_t sizey)
 {
-    uint8_t t,temp, sizex;
-    uint16_t num1;
-    
-    sizex = sizey / 2;
-    num1 = num * 100;
-    for (t=0; t<len; t++)
-    {
-        temp = (num1/mypow(10,len-t-1)) % 10;
-        if (t == (len-2))
-        {
-            lcd_show_char(x+(len-2)*sizex, y, '.', fc, bc, sizey, 0);
-            t++;
-            len += 1;
-        }
-        lcd_show_char(x+t*sizex, y, temp+48, fc, bc, sizey, 0);
-    }
+    char buf[LCD_NUM_MAX + 2];
+    /* 只在这里做一次浮点到定点的转换 */
+    uint32_t num1 = (num > 0) ? (uint32_t)(num * 100) : 0;
+
+    lcd_format_fixed(buf, num1, len);
+    lcd_show_string(x, y, (const uint8_t *)buf, fc, bc, sizey, 0);
 }
 
 /***************************************************************
@@ -1056,19 +2684,66 @@ void lcd_show_float_num1(uint16_t x, uint16_t y,float num,uint8_t len,uint16_t f
  ***************************************************************/
 void lcd_show_picture(uint16_t x, uint16_t y, uint16_t length, uint16_t width, const uint8_t *pic)
 {
-    uint16_t i,j;
-    uint32_t k = 0;
-    
-    lcd_address_set(x, y, x+length-1, y+width-1);
-    for (i=0; i<length; i++)
+    LCD_STAT_BEGIN(LCD_STAT_PICTURE);
+    lcd_win_set(x, y, x+length-1, y+width-1);
+    /* 图片数据按行攒满缓冲区后整块发送 */
+    lcd_win_bytes(pic, (uint32_t)length * width * 2);
+    lcd_win_end();
+    LCD_STAT_END();
+}
+
+
+void lcd_show_image(uint16_t x, uint16_t y, const uint8_t *img)
+{
+    uint16_t width, height;
+
+    /* 只支持16位色 */
+    if (img[1] != LCD_IMAGE_BITS)
+    {
+        return;
+    }
+    width = LCD_IMAGE_WIDTH(img);
+    height = LCD_IMAGE_HEIGHT(img);
+    if ((width == 0) || (height == 0))
+    {
+        return;
+    }
+
+    LCD_STAT_BEGIN(LCD_STAT_PICTURE);
+    lcd_win_set(x, y, x + width - 1, y + height - 1);
+    lcd_win_image(img + LCD_IMAGE_HEADER_SIZE, (uint32_t)width * height * 2);
+    lcd_win_end();
+    LCD_STAT_END();
+}
+
+
+void lcd_show_picture_compressed(uint16_t x, uint16_t y, const lcd_picture_rle_t *pic)
+{
+    const uint8_t *p = pic->data;
+    const uint8_t *end = pic->data + pic->data_len;
+    uint8_t ctrl, count;
+
+    LCD_STAT_BEGIN(LCD_STAT_PICTURE);
+    lcd_win_set(x, y, x + pic->width - 1, y + pic->height - 1);
+    /* 边解码边送入行缓冲区，不需要整幅图片大小的缓冲区 */
+    while (p < end)
     {
-        for (j=0; j<width; j++)
+        ctrl = *p++;
+        count = (ctrl & LCD_RLE_COUNT_MASK) + 1;
+        if (ctrl & LCD_RLE_RUN)
+        {
+            lcd_win_color(pic->palette[*p++], count);
+        }
+        else
         {
-            lcd_wr_data8(pic[k*2]);
-            lcd_wr_data8(pic[k*2+1]);
-            k++;
+            while (count-- > 0)
+            {
+                lcd_win_pixel(pic->palette[*p++]);
+            }
         }
     }
+    lcd_win_end();
+    LCD_STAT_END();
 }
 
 void lcd_show_text(int x, int y, char *str, int fc, int bc, int font_size, int mode)
@@ -1077,6 +2752,7 @@ void lcd_show_text(int x, int y, char *str, int fc, int bc, int font_size, int m
     int cur_x=x;
     int cur_y=y;
 
+    LCD_STAT_BEGIN(LCD_STAT_TEXT);
     while(*tmp_str != '\0')
     {
         if(tmp_str[0] > 0){
@@ -1098,4 +2774,5 @@ void lcd_show_text(int x, int y, char *str, int fc, int bc, int font_size, int m
 			cur_y+=font_size;
 		}
     }
+    LCD_STAT_END();
 }
@@ -0,0 +1,628 @@
+/*
+ * Copyright (c) 2024 iSoftStone Education Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <stdio.h>
+#include <string.h>
+
+#include "lcd.h"
+#include "lcd_widget.h"
+
+/* 控件绘制状态 */
+#define WIDGET_DIRTY        0       // 需要重绘
+#define WIDGET_DRAWN        1       // 已绘制
+#define WIDGET_REDRAWN      2       // 本轮刚重绘
+
+/* 控件变化程度 */
+#define WIDGET_SAME         0       // 无变化
+#define WIDGET_VALUE        1       // 只有数值变化，数字控件只需重绘变化的字符
+#define WIDGET_ALL          2       // 需要全部重绘
+
+/* 数字控件最多显示的字符数(含小数点) */
+#define WIDGET_NUM_MAX      (LCD_NUM_MAX + 1)
+
+/* 横屏时滚动文本控件左侧留出一个字符宽度显示最新行标记 */
+#if LCD_SCROLL_VERTICAL
+#define CONSOLE_MARK_W(c)   0
+#else
+#define CONSOLE_MARK_W(c)   ((c)->sizey / 2)
+#endif
+
+/***************************************************************
+ * 函数名称: lcd_widget_text_width
+ * 说    明: 计算文本显示宽度
+ * 参    数:
+ *       @s：文本(utf-8)
+ *       @sizey：字号
+ * 返 回 值: 宽度
+ ***************************************************************/
+static uint16_t lcd_widget_text_width(const char *s, uint8_t sizey)
+{
+    uint16_t width = 0;
+
+    while (*s != '\0')
+    {
+        if (s[0] > 0)
+        {
+            /* 英文或数字宽度为字号一半 */
+            width += sizey / 2;
+            s++;
+        }
+        else
+        {
+            width += sizey;
+            s += 3;
+        }
+    }
+
+    return width;
+}
+
+/***************************************************************
+ * 函数名称: lcd_widget_bounds
+ * 说    明: 计算控件所占区域
+ * 参    数:
+ *       @w：控件
+ *       @x1,y1,x2,y2：返回区域左上角和右下角坐标(包含)
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_widget_bounds(const lcd_widget_t *w, uint16_t *x1, uint16_t *y1, uint16_t *x2, uint16_t *y2)
+{
+    uint16_t sizex = w->sizey / 2;
+    uint16_t width = 0;
+    uint16_t height = w->sizey;
+
+    switch (w->type)
+    {
+        case LCD_WIDGET_TYPE_LABEL:
+            width = lcd_widget_text_width((const char *)w->data, w->sizey);
+            break;
+        case LCD_WIDGET_TYPE_NUMBER:
+            width = w->len * sizex;
+            break;
+        case LCD_WIDGET_TYPE_FLOAT:
+            width = (w->len + 1) * sizex;
+            break;
+        case LCD_WIDGET_TYPE_TIME:
+            width = w->y1 + w->len * sizex - w->x;
+            break;
+        case LCD_WIDGET_TYPE_ICON:
+            width = LCD_IMAGE_WIDTH((const uint8_t *)w->data);
+            height = LCD_IMAGE_HEIGHT((const uint8_t *)w->data);
+            break;
+        case LCD_WIDGET_TYPE_ICON_RLE:
+            width = ((const lcd_picture_rle_t *)w->data)->width;
+            height = ((const lcd_picture_rle_t *)w->data)->height;
+            break;
+        case LCD_WIDGET_TYPE_LINE:
+            *x1 = (w->x < w->x1) ? w->x : w->x1;
+            *x2 = (w->x < w->x1) ? w->x1 : w->x;
+            *y1 = (w->y < w->y1) ? w->y : w->y1;
+            *y2 = (w->y < w->y1) ? w->y1 : w->y;
+            return;
+        default:
+            break;
+    }
+
+    *x1 = w->x;
+    *y1 = w->y;
+    *x2 = w->x + ((width > 0) ? (width - 1) : 0);
+    *y2 = w->y + ((height > 0) ? (height - 1) : 0);
+}
+
+/***************************************************************
+ * 函数名称: lcd_widget_overlap
+ * 说    明: 判断两个控件区域是否重叠
+ * 参    数:
+ *       @a,b：控件
+ * 返 回 值: 1为重叠，0为不重叠
+ ***************************************************************/
+static uint8_t lcd_widget_overlap(const lcd_widget_t *a, const lcd_widget_t *b)
+{
+    uint16_t ax1, ay1, ax2, ay2;
+    uint16_t bx1, by1, bx2, by2;
+
+    lcd_widget_bounds(a, &ax1, &ay1, &ax2, &ay2);
+    lcd_widget_bounds(b, &bx1, &by1, &bx2, &by2);
+
+    return (ax1 <= bx2) && (bx1 <= ax2) && (ay1 <= by2) && (by1 <= ay2);
+}
+
+/***************************************************************
+ * 函数名称: lcd_widget_format
+ * 说    明: 按控件类型把数值格式化为显示的字符串
+ * 参    数:
+ *       @w：控件
+ *       @value：数值；时间控件为时或分
+ *       @buf：返回字符串
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_widget_format(const lcd_widget_t *w, int32_t value, char *buf)
+{
+    if (w->type == LCD_WIDGET_TYPE_FLOAT)
+    {
+        lcd_format_fixed(buf, (uint32_t)value, w->len);
+    }
+    else
+    {
+        lcd_format_int(buf, (uint32_t)value, w->len);
+    }
+}
+
+/***************************************************************
+ * 函数名称: lcd_widget_show_digits
+ * 说    明: 显示数字字符串；给出上次显示的字符串时只重绘有变化的字符，
+ *           相邻的变化字符合并为一次绘制
+ * 参    数:
+ *       @w：控件
+ *       @x：字符串起始点X坐标
+ *       @value：数值
+ *       @old：上次显示的数值，为NULL时全部重绘
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_widget_show_digits(const lcd_widget_t *w, uint16_t x, int32_t value, const int32_t *old)
+{
+    char text[WIDGET_NUM_MAX + 1];
+    char prev[WIDGET_NUM_MAX + 1];
+    uint8_t i = 0, start;
+    char c;
+
+    lcd_widget_format(w, value, text);
+    if (old == NULL)
+    {
+        lcd_show_string(x, w->y, (const uint8_t *)text, w->fc, w->bc, w->sizey, 0);
+        return;
+    }
+
+    /* 位数相同，两个字符串等长 */
+    lcd_widget_format(w, *old, prev);
+    while (text[i] != '\0')
+    {
+        if (text[i] == prev[i])
+        {
+            i++;
+            continue;
+        }
+        start = i;
+        while ((text[i] != '\0') && (text[i] != prev[i]))
+        {
+            i++;
+        }
+        c = text[i];
+        text[i] = '\0';
+        lcd_show_string(x + start * (w->sizey / 2), w->y, (const uint8_t *)&text[start],
+            w->fc, w->bc, w->sizey, 0);
+        text[i] = c;
+    }
+}
+
+/***************************************************************
+ * 函数名称: lcd_widget_draw
+ * 说    明: 绘制单个控件
+ * 参    数:
+ *       @w：控件
+ *       @change：WIDGET_VALUE只重绘数字中变化的字符，WIDGET_ALL全部重绘
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_widget_draw(lcd_widget_t *w, uint8_t change)
+{
+    int32_t hour, min;
+
+    switch (w->type)
+    {
+        case LCD_WIDGET_TYPE_LABEL:
+            lcd_show_text(w->x, w->y, (char *)w->data, w->fc, w->bc, w->sizey, 0);
+            break;
+        case LCD_WIDGET_TYPE_NUMBER:
+        case LCD_WIDGET_TYPE_FLOAT:
+            lcd_widget_show_digits(w, w->x, w->value,
+                (change == WIDGET_VALUE) ? &w->drawn_value : NULL);
+            break;
+        case LCD_WIDGET_TYPE_TIME:
+            hour = (w->drawn_value >> 8) & 0xFF;
+            min = w->drawn_value & 0xFF;
+            lcd_widget_show_digits(w, w->x, (w->value >> 8) & 0xFF,
+                (change == WIDGET_VALUE) ? &hour : NULL);
+            if (change == WIDGET_ALL)
+            {
+                lcd_show_string(w->x1, w->y, (const uint8_t *)":", w->fc, w->bc, w->sizey, 0);
+            }
+            lcd_widget_show_digits(w, w->y1, w->value & 0xFF,
+                (change == WIDGET_VALUE) ? &min : NULL);
+            break;
+        case LCD_WIDGET_TYPE_ICON:
+            lcd_show_image(w->x, w->y, (const uint8_t *)w->data);
+            break;
+        case LCD_WIDGET_TYPE_ICON_RLE:
+            lcd_show_picture_compressed(w->x, w->y, (const lcd_picture_rle_t *)w->data);
+            break;
+        case LCD_WIDGET_TYPE_LINE:
+            lcd_draw_line(w->x, w->y, w->x1, w->y1, w->fc);
+            break;
+        default:
+            break;
+    }
+
+    w->drawn_value = w->value;
+    w->drawn_fc = w->fc;
+    w->drawn_bc = w->bc;
+    w->drawn_data = w->data;
+}
+
+/***************************************************************
+ * 函数名称: lcd_widget_changed
+ * 说    明: 判断控件内容或颜色与上次绘制时相比的变化程度
+ * 参    数:
+ *       @w：控件
+ * 返 回 值: WIDGET_SAME、WIDGET_VALUE或WIDGET_ALL
+ ***************************************************************/
+static uint8_t lcd_widget_changed(const lcd_widget_t *w)
+{
+    if ((w->drawn == WIDGET_DIRTY) || (w->fc != w->drawn_fc)
+        || (w->bc != w->drawn_bc) || (w->data != w->drawn_data))
+    {
+        return WIDGET_ALL;
+    }
+
+    return (w->value != w->drawn_value) ? WIDGET_VALUE : WIDGET_SAME;
+}
+
+
+void lcd_widget_set(lcd_widget_t *w, int32_t value, uint16_t fc, uint16_t bc)
+{
+    w->value = value;
+    w->fc = fc;
+    w->bc = bc;
+}
+
+
+void lcd_widget_invalidate(lcd_widget_t *w, uint16_t count)
+{
+    uint16_t i;
+
+    for (i = 0; i < count; i++)
+    {
+        w[i].drawn = WIDGET_DIRTY;
+    }
+}
+
+
+void lcd_widget_draw_fixed(lcd_widget_t *w, uint16_t count)
+{
+    uint16_t i;
+
+    for (i = 0; i < count; i++)
+    {
+        if (w[i].fixed)
+        {
+            lcd_widget_draw(&w[i], WIDGET_ALL);
+            w[i].drawn = WIDGET_DRAWN;
+        }
+        else
+        {
+            w[i].drawn = WIDGET_DIRTY;
+        }
+    }
+}
+
+
+void lcd_widget_skip_fixed(lcd_widget_t *w, uint16_t count)
+{
+    uint16_t i;
+
+    for (i = 0; i < count; i++)
+    {
+        if (w[i].fixed)
+        {
+            /* 按当前内容记为已绘制 */
+            w[i].drawn_value = w[i].value;
+            w[i].drawn_fc = w[i].fc;
+            w[i].drawn_bc = w[i].bc;
+            w[i].drawn_data = w[i].data;
+            w[i].drawn = WIDGET_DRAWN;
+        }
+        else
+        {
+            w[i].drawn = WIDGET_DIRTY;
+        }
+    }
+}
+
+
+uint16_t lcd_widget_render(lcd_widget_t *w, uint16_t count)
+{
+    uint16_t i, j;
+    uint16_t redraw = 0;
+    uint8_t change;
+
+    for (i = 0; i < count; i++)
+    {
+        change = lcd_widget_changed(&w[i]);
+
+        /* 前面重绘过的控件可能覆盖了本控件，需要全部重绘 */
+        for (j = 0; (j < i) && (change != WIDGET_ALL); j++)
+        {
+            if ((w[j].drawn == WIDGET_REDRAWN) && lcd_widget_overlap(&w[j], &w[i]))
+            {
+                change = WIDGET_ALL;
+            }
+        }
+
+        if (change != WIDGET_SAME)
+        {
+            lcd_widget_draw(&w[i], change);
+            w[i].drawn = WIDGET_REDRAWN;
+            redraw++;
+        }
+    }
+
+    for (i = 0; i < count; i++)
+    {
+        w[i].drawn = WIDGET_DRAWN;
+    }
+
+    return redraw;
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_console_draw_line
+ * 说    明: 绘制滚动文本控件的第n行(从0开始计数)，文本后的空白用背景色填充
+ * 参    数:
+ *       @c：控件
+ *       @n：行号
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_console_draw_line(const lcd_console_t *c, uint32_t n)
+{
+    char buf[LCD_CONSOLE_LINE_MAX];
+    const char *s = c->text[n % c->lines];
+    uint16_t x = c->x + CONSOLE_MARK_W(c);
+    uint16_t y = c->y + (n % c->lines) * c->sizey;
+    uint16_t width = 0;
+    uint16_t max = c->width - CONSOLE_MARK_W(c);
+    uint8_t len = 0;
+    uint8_t step, w;
+
+    /* 截取能完整显示的字符 */
+    while (s[len] != '\0')
+    {
+        step = (s[len] > 0) ? 1 : 3;
+        w = (s[len] > 0) ? (c->sizey / 2) : c->sizey;
+        if (width + w > max)
+        {
+            break;
+        }
+        width += w;
+        len += step;
+    }
+    memcpy(buf, s, len);
+    buf[len] = '\0';
+
+    lcd_show_text(x, y, buf, c->fc, c->bc, c->sizey, 0);
+    if (width < max)
+    {
+        lcd_fill(x + width, y, c->x + c->width, y + c->sizey, c->bc);
+    }
+}
+
+#if !LCD_SCROLL_VERTICAL
+/***************************************************************
+ * 函数名称: lcd_console_draw_mark
+ * 说    明: 在第n行左侧显示或清除最新行标记
+ * 参    数:
+ *       @c：控件
+ *       @n：行号
+ *       @mark：'>'显示标记，' '清除标记
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_console_draw_mark(const lcd_console_t *c, uint32_t n, uint8_t mark)
+{
+    lcd_show_char(c->x, c->y + (n % c->lines) * c->sizey, mark, c->fc, c->bc, c->sizey, 0);
+}
+#endif
+
+
+void lcd_console_add(lcd_console_t *c, const char *text)
+{
+    char *line = c->text[c->total % c->lines];
+    size_t len = strlen(text);
+
+    if (len > LCD_CONSOLE_LINE_MAX - 1)
+    {
+        len = LCD_CONSOLE_LINE_MAX - 1;
+        /* 不截断半个汉字 */
+        while ((len > 0) && ((text[len] & 0xC0) == 0x80))
+        {
+            len--;
+        }
+    }
+    memcpy(line, text, len);
+    line[len] = '\0';
+    c->total++;
+}
+
+
+uint16_t lcd_console_render(lcd_console_t *c)
+{
+    uint32_t first = (c->total > c->lines) ? (c->total - c->lines) : 0;
+    uint32_t last = c->drawn;
+    uint32_t n;
+
+    if (!c->shown)
+    {
+        /* 首次显示，清空区域并绘制全部行 */
+        lcd_fill(c->x, c->y, c->x + c->width, c->y + c->lines * c->sizey, c->bc);
+#if LCD_SCROLL_VERTICAL
+        lcd_scroll_area(c->y, c->lines * c->sizey);
+#endif
+        c->drawn = first;
+        c->shown = 1;
+        last = 0;
+    }
+    else if (c->drawn == c->total)
+    {
+        return 0;
+    }
+    else if (c->drawn < first)
+    {
+        /* 未绘制的行已超过一屏，更早的行已被覆盖 */
+        c->drawn = first;
+    }
+
+#if !LCD_SCROLL_VERTICAL
+    /* 清除上次最新行的标记 */
+    if (last > 0)
+    {
+        lcd_console_draw_mark(c, last - 1, ' ');
+    }
+#endif
+
+    for (n = c->drawn; n < c->total; n++)
+    {
+        lcd_console_draw_line(c, n);
+    }
+
+#if LCD_SCROLL_VERTICAL
+    /* 最旧的一行移到区域顶部，只有一条0x37命令 */
+    lcd_scroll_start((c->total > c->lines) ? (c->total % c->lines) * c->sizey : 0);
+#else
+    if (c->total > 0)
+    {
+        lcd_console_draw_mark(c, c->total - 1, '>');
+    }
+#endif
+
+    n = c->total - c->drawn;
+    c->drawn = c->total;
+    return n;
+}
+
+
+void lcd_console_hide(lcd_console_t *c)
+{
+    if (c->shown)
+    {
+#if LCD_SCROLL_VERTICAL
+        lcd_scroll_area(0, LCD_SCROLL_LINES);
+        lcd_scroll_start(0);
+#endif
+        c->shown = 0;
+    }
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_chart_draw_column
+ * 说    明: 绘制曲线图控件第n个采样(从0开始计数)所在的一列，
+ *           从前一个采样的高度到本采样的高度画竖线，其余为背景色
+ * 参    数:
+ *       @c：控件
+ *       @n：采样序号
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_chart_draw_column(const lcd_chart_t *c, uint32_t n)
+{
+    uint16_t x = c->x + n % c->width;
+    uint8_t lo = c->data[n % c->width];
+    uint8_t hi = lo;
+    uint8_t prev;
+    uint16_t top, bottom;
+
+    if (n > 0)
+    {
+        prev = c->data[(n - 1) % c->width];
+        lo = (prev < lo) ? prev : lo;
+        hi = (prev > hi) ? prev : hi;
+    }
+
+    /* 高度从区域底部向上计算 */
+    top = c->y + c->height - 1 - hi;
+    bottom = c->y + c->height - lo;
+    if (top > c->y)
+    {
+        lcd_fill(x, c->y, x + 1, top, c->bc);
+    }
+    lcd_fill(x, top, x + 1, bottom, c->fc);
+    if (bottom < c->y + c->height)
+    {
+        lcd_fill(x, bottom, x + 1, c->y + c->height, c->bc);
+    }
+}
+
+
+void lcd_chart_add(lcd_chart_t *c, int32_t value)
+{
+    if (value <= c->min)
+    {
+        value = 0;
+    }
+    else if (value >= c->max)
+    {
+        value = c->height - 1;
+    }
+    else
+    {
+        value = (value - c->min) * (c->height - 1) / (c->max - c->min);
+    }
+    c->data[c->total % c->width] = (uint8_t)value;
+    c->total++;
+}
+
+
+uint16_t lcd_chart_render(lcd_chart_t *c)
+{
+    /* 间隔列占用一列，最多显示width - 1个采样 */
+    uint32_t first = (c->total >= c->width) ? (c->total - c->width + 1) : 0;
+    uint32_t n;
+    uint16_t x;
+
+    if (!c->shown)
+    {
+        /* 首次显示，清空区域并绘制全部采样 */
+        lcd_fill(c->x, c->y, c->x + c->width, c->y + c->height, c->bc);
+        c->drawn = first;
+        c->shown = 1;
+    }
+    else if (c->drawn == c->total)
+    {
+        return 0;
+    }
+    else if (c->drawn < first)
+    {
+        /* 未绘制的采样已超过一屏，更早的采样已被覆盖 */
+        c->drawn = first;
+    }
+
+    for (n = c->drawn; n < c->total; n++)
+    {
+        lcd_chart_draw_column(c, n);
+    }
+
+    /* 清空最新采样右侧的一列，标出循环覆盖的位置 */
+    if (c->total > 0)
+    {
+        x = c->x + c->total % c->width;
+        lcd_fill(x, c->y, x + 1, c->y + c->height, c->bc);
+    }
+
+    n = c->total - c->drawn;
+    c->drawn = c->total;
+    return n;
+}
+
+
+void lcd_chart_hide(lcd_chart_t *c)
+{
+    c->shown = 0;
+}
@@ -0,0 +1,1319 @@
+/* Generated by tools/picture_rle.py from page_bg_raw.c, do not edit. */
+#include "picture.h"
+
+/* page0_bg: 320x240, 28 colors, 153600 -> 5698 bytes */
+static const uint16_t page0_bg_palette[28] =
+{
+    0xFFFF, 0x0000, 0x53D4, 0x01CF, 0x22B1, 0xBE5B, 0xADFA, 0x4373,
+    0x6455, 0x9D79, 0x1230, 0xEF9E, 0x3312, 0xDF1D, 0xCEBC, 0xC4C4,
+    0xBC40, 0xD58A, 0xE6B5, 0xEEF7, 0xCD06, 0xCD48, 0xC482, 0xF77B,
+    0xEF39, 0xF7BD, 0xE673, 0xD5CC,
+};
+
+static const uint8_t page0_bg_data[5642] =
+{
+    0xEA, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00,
+    0x00, 0x01, 0xFF, 0x00, 0x87, 0x00, 0x00, 0x02, 0x89, 0x03, 0x00, 0x02, 0x8D, 0x00, 0x00, 0x04,
+    0x84, 0x00, 0x81, 0x02, 0x91, 0x00, 0x01, 0x05, 0x04, 0x95, 0x00, 0x00, 0x01, 0x9D, 0x00, 0x00,
+    0x02, 0x89, 0x03, 0x00, 0x02, 0x8D, 0x00, 0x00, 0x04, 0x84, 0x00, 0x81, 0x02, 0x91, 0x00, 0x01,
+    0x05, 0x04, 0x95, 0x00, 0x00, 0x01, 0x9D, 0x00, 0x00, 0x02, 0x89, 0x03, 0x00, 0x02, 0x8D, 0x00,
+    0x00, 0x04, 0x84, 0x00, 0x81, 0x02, 0x91, 0x00, 0x01, 0x05, 0x04, 0xB3, 0x00, 0x01, 0x03, 0x06,
+    0x87, 0x00, 0x01, 0x06, 0x03, 0x8C, 0x00, 0x02, 0x06, 0x03, 0x06, 0x82, 0x00, 0x00, 0x06, 0x81,
+    0x03, 0x00, 0x06, 0x81, 0x00, 0x02, 0x06, 0x04, 0x06, 0x8B, 0x00, 0x02, 0x07, 0x08, 0x09, 0x94,
+    0x00, 0x00, 0x01, 0x9D, 0x00, 0x01, 0x03, 0x06, 0x87, 0x00, 0x01, 0x06, 0x03, 0x8C, 0x00, 0x02,
+    0x06, 0x03, 0x06, 0x82, 0x00, 0x00, 0x06, 0x81, 0x03, 0x00, 0x06, 0x81, 0x00, 0x02, 0x06, 0x04,
+    0x06, 0x8B, 0x00, 0x02, 0x07, 0x08, 0x09, 0x94, 0x00, 0x00, 0x01, 0x9D, 0x00, 0x01, 0x03, 0x06,
+    0x87, 0x00, 0x01, 0x06, 0x03, 0x8C, 0x00, 0x02, 0x06, 0x03, 0x06, 0x82, 0x00, 0x00, 0x06, 0x81,
+    0x03, 0x00, 0x06, 0x81, 0x00, 0x02, 0x06, 0x04, 0x06, 0x8B, 0x00, 0x02, 0x07, 0x08, 0x09, 0xB2,
+    0x00, 0x00, 0x03, 0x89, 0x00, 0x00, 0x03, 0x86, 0x00, 0x00, 0x04, 0x92, 0x03, 0x00, 0x04, 0x8A,
+    0x00, 0x04, 0x06, 0x0A, 0x0B, 0x04, 0x06, 0x93, 0x00, 0x00, 0x01, 0x9D, 0x00, 0x00, 0x03, 0x89,
+    0x00, 0x00, 0x03, 0x86, 0x00, 0x00, 0x04, 0x92, 0x03, 0x00, 0x04, 0x8A, 0x00, 0x04, 0x06, 0x0A,
+    0x0B, 0x04, 0x06, 0x93, 0x00, 0x00, 0x01, 0x91, 0x00, 0x02, 0x06, 0x04, 0x06, 0x88, 0x00, 0x00,
+    0x03, 0x89, 0x00, 0x00, 0x03, 0x86, 0x00, 0x00, 0x04, 0x92, 0x03, 0x00, 0x04, 0x8A, 0x00, 0x04,
+    0x06, 0x0A, 0x0B, 0x04, 0x06, 0xB1, 0x00, 0x00, 0x03, 0x89, 0x00, 0x00, 0x03, 0x8C, 0x00, 0x02,
+    0x06, 0x03, 0x06, 0x82, 0x00, 0x03, 0x06, 0x03, 0x0C, 0x05, 0x8E, 0x00, 0x06, 0x06, 0x04, 0x06,
+    0x00, 0x06, 0x04, 0x06, 0x92, 0x00, 0x00, 0x01, 0x90, 0x00, 0x02, 0x06, 0x04, 0x06, 0x89, 0x00,
+    0x00, 0x03, 0x89, 0x00, 0x00, 0x03, 0x8C, 0x00, 0x02, 0x06, 0x03, 0x06, 0x82, 0x00, 0x03, 0x06,
+    0x03, 0x0C, 0x05, 0x8E, 0x00, 0x06, 0x06, 0x04, 0x06, 0x00, 0x06, 0x04, 0x06, 0x92, 0x00, 0x00,
+    0x01, 0x82, 0x00, 0x00, 0x04, 0x8F, 0x03, 0x00, 0x04, 0x88, 0x00, 0x00, 0x03, 0x89, 0x00, 0x00,
+    0x03, 0x8C, 0x00, 0x02, 0x06, 0x03, 0x06, 0x82, 0x00, 0x03, 0x06, 0x03, 0x0C, 0x05, 0x8E, 0x00,
+    0x06, 0x06, 0x04, 0x06, 0x00, 0x06, 0x04, 0x06, 0xB0, 0x00, 0x00, 0x03, 0x89, 0x00, 0x00, 0x03,
+    0x8C, 0x00, 0x01, 0x06, 0x0A, 0x84, 0x00, 0x01, 0x04, 0x05, 0x8E, 0x00, 0x02, 0x06, 0x04, 0x06,
+    0x82, 0x00, 0x03, 0x06, 0x0A, 0x07, 0x05, 0x90, 0x00, 0x00, 0x01, 0x83, 0x00, 0x00, 0x04, 0x8D,
+    0x03, 0x00, 0x04, 0x89, 0x00, 0x00, 0x03, 0x89, 0x00, 0x00, 0x03, 0x8C, 0x00, 0x01, 0x06, 0x0A,
+    0x84, 0x00, 0x01, 0x04, 0x05, 0x8E, 0x00, 0x02, 0x06, 0x04, 0x06, 0x82, 0x00, 0x03, 0x06, 0x0A,
+    0x07, 0x05, 0x90, 0x00, 0x00, 0x01, 0x9D, 0x00, 0x00, 0x03, 0x89, 0x00, 0x00, 0x03, 0x8C, 0x00,
+    0x01, 0x06, 0x0A, 0x84, 0x00, 0x01, 0x04, 0x05, 0x8E, 0x00, 0x02, 0x06, 0x04, 0x06, 0x82, 0x00,
+    0x03, 0x06, 0x0A, 0x07, 0x05, 0xAE, 0x00, 0x01, 0x03, 0x06, 0x87, 0x00, 0x01, 0x06, 0x03, 0x8B,
+    0x00, 0x02, 0x02, 0x0A, 0x06, 0x94, 0x00, 0x02, 0x06, 0x04, 0x0D, 0x84, 0x00, 0x00, 0x0D, 0x81,
+    0x03, 0x01, 0x07, 0x05, 0x8E, 0x00, 0x00, 0x01, 0x9D, 0x00, 0x01, 0x03, 0x06, 0x87, 0x00, 0x01,
+    0x06, 0x03, 0x8B, 0x00, 0x02, 0x02, 0x0A, 0x06, 0x94, 0x00, 0x02, 0x06, 0x04, 0x0D, 0x84, 0x00,
+    0x00, 0x0D, 0x81, 0x03, 0x01, 0x07, 0x05, 0x8E, 0x00, 0x00, 0x01, 0x9D, 0x00, 0x01, 0x03, 0x06,
+    0x87, 0x00, 0x01, 0x06, 0x03, 0x8B, 0x00, 0x02, 0x02, 0x0A, 0x06, 0x94, 0x00, 0x02, 0x06, 0x04,
+    0x0D, 0x84, 0x00, 0x00, 0x0D, 0x81, 0x03, 0x01, 0x07, 0x05, 0xAC, 0x00, 0x8B, 0x03, 0x8A, 0x00,
+    0x02, 0x06, 0x0A, 0x06, 0x85, 0x00, 0x01, 0x04, 0x06, 0x8C, 0x00, 0x03, 0x06, 0x04, 0x0D, 0x04,
+    0x85, 0x03, 0x02, 0x02, 0x0D, 0x02, 0x81, 0x03, 0x01, 0x07, 0x05, 0x8B, 0x00, 0x00, 0x01, 0x9D,
+    0x00, 0x8B, 0x03, 0x8A, 0x00, 0x02, 0x06, 0x0A, 0x06, 0x85, 0x00, 0x01, 0x04, 0x06, 0x8C, 0x00,
+    0x03, 0x06, 0x04, 0x0D, 0x04, 0x85, 0x03, 0x02, 0x02, 0x0D, 0x02, 0x81, 0x03, 0x01, 0x07, 0x05,
+    0x8B, 0x00, 0x00, 0x01, 0x9D, 0x00, 0x8B, 0x03, 0x8A, 0x00, 0x02, 0x06, 0x0A, 0x06, 0x85, 0x00,
+    0x01, 0x04, 0x06, 0x8C, 0x00, 0x03, 0x06, 0x04, 0x0D, 0x04, 0x85, 0x03, 0x02, 0x02, 0x0D, 0x02,
+    0x81, 0x03, 0x01, 0x07, 0x05, 0xA8, 0x00, 0x02, 0x06, 0x03, 0x0D, 0x87, 0x00, 0x02, 0x0D, 0x03,
+    0x06, 0x88, 0x00, 0x02, 0x05, 0x0A, 0x06, 0x81, 0x00, 0x01, 0x04, 0x06, 0x81, 0x00, 0x02, 0x05,
+    0x03, 0x04, 0x8A, 0x00, 0x00, 0x06, 0x81, 0x0A, 0x00, 0x06, 0x8A, 0x00, 0x03, 0x05, 0x07, 0x03,
+    0x04, 0x8B, 0x00, 0x00, 0x01, 0x9C, 0x00, 0x02, 0x06, 0x03, 0x0D, 0x87, 0x00, 0x02, 0x0D, 0x03,
+    0x06, 0x88, 0x00, 0x02, 0x05, 0x0A, 0x06, 0x81, 0x00, 0x01, 0x04, 0x06, 0x81, 0x00, 0x02, 0x05,
+    0x03, 0x04, 0x8A, 0x00, 0x00, 0x06, 0x81, 0x0A, 0x00, 0x06, 0x8A, 0x00, 0x03, 0x05, 0x07, 0x03,
+    0x04, 0x8B, 0x00, 0x00, 0x01, 0x9C, 0x00, 0x02, 0x06, 0x03, 0x0D, 0x87, 0x00, 0x02, 0x0D, 0x03,
+    0x06, 0x88, 0x00, 0x02, 0x05, 0x0A, 0x06, 0x81, 0x00, 0x01, 0x04, 0x06, 0x81, 0x00, 0x02, 0x05,
+    0x03, 0x04, 0x8A, 0x00, 0x00, 0x06, 0x81, 0x0A, 0x00, 0x06, 0x8A, 0x00, 0x03, 0x05, 0x07, 0x03,
+    0x04, 0xA5, 0x00, 0x00, 0x04, 0x91, 0x03, 0x00, 0x04, 0x85, 0x00, 0x01, 0x07, 0x02, 0x81, 0x00,
+    0x02, 0x05, 0x03, 0x04, 0x81, 0x00, 0x02, 0x07, 0x03, 0x0D, 0x88, 0x00, 0x00, 0x06, 0x81, 0x0A,
+    0x00, 0x06, 0x9C, 0x00, 0x00, 0x01, 0x99, 0x00, 0x00, 0x04, 0x91, 0x03, 0x00, 0x04, 0x85, 0x00,
+    0x01, 0x07, 0x02, 0x81, 0x00, 0x02, 0x05, 0x03, 0x04, 0x81, 0x00, 0x02, 0x07, 0x03, 0x0D, 0x88,
+    0x00, 0x00, 0x06, 0x81, 0x0A, 0x00, 0x06, 0x9C, 0x00, 0x00, 0x01, 0x99, 0x00, 0x00, 0x04, 0x91,
+    0x03, 0x00, 0x04, 0x85, 0x00, 0x01, 0x07, 0x02, 0x81, 0x00, 0x02, 0x05, 0x03, 0x04, 0x81, 0x00,
+    0x02, 0x07, 0x03, 0x0D, 0x88, 0x00, 0x00, 0x06, 0x81, 0x0A, 0x00, 0x06, 0xBB, 0x00, 0x03, 0x06,
+    0x03, 0x0C, 0x05, 0x8F, 0x00, 0x04, 0x09, 0x0A, 0x0D, 0x00, 0x05, 0x81, 0x0C, 0x00, 0x05, 0x81,
+    0x00, 0x87, 0x03, 0x00, 0x04, 0x82, 0x00, 0x01, 0x0C, 0x06, 0x83, 0x00, 0x00, 0x02, 0x88, 0x03,
+    0x00, 0x04, 0x8F, 0x00, 0x00, 0x01, 0x9E, 0x00, 0x03, 0x06, 0x03, 0x0C, 0x05, 0x8F, 0x00, 0x04,
+    0x09, 0x0A, 0x0D, 0x00, 0x05, 0x81, 0x0C, 0x00, 0x05, 0x81, 0x00, 0x87, 0x03, 0x00, 0x04, 0x82,
+    0x00, 0x01, 0x0C, 0x06, 0x83, 0x00, 0x00, 0x02, 0x88, 0x03, 0x00, 0x04, 0x8F, 0x00, 0x00, 0x01,
+    0x9E, 0x00, 0x03, 0x06, 0x03, 0x0C, 0x05, 0x8F, 0x00, 0x04, 0x09, 0x0A, 0x0D, 0x00, 0x05, 0x81,
+    0x0C, 0x00, 0x05, 0x81, 0x00, 0x87, 0x03, 0x00, 0x04, 0x82, 0x00, 0x01, 0x0C, 0x06, 0x83, 0x00,
+    0x00, 0x02, 0x88, 0x03, 0x00, 0x04, 0xA2, 0x00, 0x02, 0x06, 0x04, 0x06, 0x88, 0x00, 0x02, 0x05,
+    0x03, 0x05, 0x8F, 0x00, 0x03, 0x02, 0x08, 0x0E, 0x0A, 0x81, 0x03, 0x01, 0x0C, 0x0E, 0x81, 0x00,
+    0x02, 0x06, 0x0A, 0x06, 0x83, 0x00, 0x02, 0x06, 0x03, 0x06, 0x88, 0x00, 0x01, 0x03, 0x06, 0x85,
+    0x00, 0x02, 0x06, 0x03, 0x06, 0x8F, 0x00, 0x00, 0x01, 0x9E, 0x00, 0x02, 0x05, 0x03, 0x05, 0x8F,
+    0x00, 0x03, 0x02, 0x08, 0x0E, 0x0A, 0x81, 0x03, 0x01, 0x0C, 0x0E, 0x81, 0x00, 0x02, 0x06, 0x0A,
+    0x06, 0x83, 0x00, 0x02, 0x06, 0x03, 0x06, 0x88, 0x00, 0x01, 0x03, 0x06, 0x85, 0x00, 0x02, 0x06,
+    0x03, 0x06, 0x8F, 0x00, 0x00, 0x01, 0x8F, 0x00, 0x02, 0x06, 0x04, 0x06, 0x8B, 0x00, 0x02, 0x05,
+    0x03, 0x05, 0x8F, 0x00, 0x03, 0x02, 0x08, 0x0E, 0x0A, 0x81, 0x03, 0x01, 0x0C, 0x0E, 0x81, 0x00,
+    0x02, 0x06, 0x0A, 0x06, 0x83, 0x00, 0x02, 0x06, 0x03, 0x06, 0x88, 0x00, 0x01, 0x03, 0x06, 0x85,
+    0x00, 0x02, 0x06, 0x03, 0x06, 0x90, 0x00, 0x00, 0x04, 0x92, 0x03, 0x00, 0x04, 0x88, 0x00, 0x02,
+    0x07, 0x03, 0x06, 0x8F, 0x00, 0x06, 0x02, 0x03, 0x0A, 0x06, 0x0D, 0x0A, 0x05, 0x81, 0x00, 0x02,
+    0x06, 0x04, 0x06, 0x85, 0x00, 0x00, 0x03, 0x89, 0x00, 0x01, 0x03, 0x06, 0x85, 0x00, 0x01, 0x06,
+    0x03, 0x90, 0x00, 0x00, 0x01, 0x9E, 0x00, 0x02, 0x07, 0x03, 0x06, 0x8F, 0x00, 0x06, 0x02, 0x03,
+    0x0A, 0x06, 0x0D, 0x0A, 0x05, 0x81, 0x00, 0x02, 0x06, 0x04, 0x06, 0x85, 0x00, 0x00, 0x03, 0x89,
+    0x00, 0x01, 0x03, 0x06, 0x85, 0x00, 0x01, 0x06, 0x03, 0x90, 0x00, 0x00, 0x01, 0x83, 0x00, 0x00,
+    0x04, 0x8C, 0x03, 0x00, 0x04, 0x8B, 0x00, 0x02, 0x07, 0x03, 0x06, 0x8F, 0x00, 0x06, 0x02, 0x03,
+    0x0A, 0x06, 0x0D, 0x0A, 0x05, 0x81, 0x00, 0x02, 0x06, 0x04, 0x06, 0x85, 0x00, 0x00, 0x03, 0x89,
+    0x00, 0x01, 0x03, 0x06, 0x85, 0x00, 0x01, 0x06, 0x03, 0xAF, 0x00, 0x8A, 0x03, 0x00, 0x02, 0x89,
+    0x00, 0x02, 0x06, 0x04, 0x06, 0x82, 0x00, 0x01, 0x0A, 0x06, 0x86, 0x00, 0x00, 0x03, 0x89, 0x00,
+    0x89, 0x03, 0x00, 0x06, 0x8F, 0x00, 0x00, 0x01, 0x9E, 0x00, 0x8A, 0x03, 0x00, 0x02, 0x89, 0x00,
+    0x02, 0x06, 0x04, 0x06, 0x82, 0x00, 0x01, 0x0A, 0x06, 0x86, 0x00, 0x00, 0x03, 0x89, 0x00, 0x89,
+    0x03, 0x00, 0x06, 0x8F, 0x00, 0x00, 0x01, 0x9E, 0x00, 0x8A, 0x03, 0x00, 0x02, 0x89, 0x00, 0x02,
+    0x06, 0x04, 0x06, 0x82, 0x00, 0x01, 0x0A, 0x06, 0x86, 0x00, 0x00, 0x03, 0x89, 0x00, 0x89, 0x03,
+    0x00, 0x06, 0xAE, 0x00, 0x01, 0x04, 0x06, 0x86, 0x00, 0x02, 0x06, 0x03, 0x07, 0x88, 0x00, 0x02,
+    0x05, 0x0A, 0x06, 0x83, 0x00, 0x03, 0x04, 0x00, 0x0C, 0x06, 0x83, 0x00, 0x01, 0x05, 0x03, 0x89,
+    0x00, 0x01, 0x04, 0x06, 0x85, 0x00, 0x02, 0x05, 0x07, 0x04, 0x8F, 0x00, 0x00, 0x01, 0x9E, 0x00,
+    0x01, 0x04, 0x06, 0x86, 0x00, 0x02, 0x06, 0x03, 0x07, 0x88, 0x00, 0x02, 0x05, 0x0A, 0x06, 0x83,
+    0x00, 0x03, 0x04, 0x00, 0x0C, 0x06, 0x83, 0x00, 0x01, 0x05, 0x03, 0x89, 0x00, 0x01, 0x04, 0x06,
+    0x85, 0x00, 0x02, 0x05, 0x07, 0x04, 0x8F, 0x00, 0x00, 0x01, 0x9E, 0x00, 0x01, 0x04, 0x06, 0x86,
+    0x00, 0x02, 0x06, 0x03, 0x07, 0x88, 0x00, 0x02, 0x05, 0x0A, 0x06, 0x83, 0x00, 0x03, 0x04, 0x00,
+    0x0C, 0x06, 0x83, 0x00, 0x01, 0x05, 0x03, 0x89, 0x00, 0x01, 0x04, 0x06, 0x85, 0x00, 0x02, 0x05,
+    0x07, 0x04, 0xB8, 0x00, 0x01, 0x03, 0x05, 0x87, 0x00, 0x03, 0x0E, 0x0C, 0x03, 0x06, 0x85, 0x00,
+    0x02, 0x06, 0x0A, 0x02, 0x82, 0x00, 0x01, 0x07, 0x03, 0xA4, 0x00, 0x00, 0x01, 0xA8, 0x00, 0x01,
+    0x03, 0x05, 0x87, 0x00, 0x03, 0x0E, 0x0C, 0x03, 0x06, 0x85, 0x00, 0x02, 0x06, 0x0A, 0x02, 0x82,
+    0x00, 0x01, 0x07, 0x03, 0xA4, 0x00, 0x00, 0x01, 0xA8, 0x00, 0x01, 0x03, 0x05, 0x87, 0x00, 0x03,
+    0x0E, 0x0C, 0x03, 0x06, 0x85, 0x00, 0x02, 0x06, 0x0A, 0x02, 0x82, 0x00, 0x01, 0x07, 0x03, 0xCD,
+    0x00, 0x00, 0x03, 0x88, 0x00, 0x00, 0x07, 0x84, 0x03, 0x00, 0x04, 0x83, 0x00, 0x01, 0x06, 0x03,
+    0x82, 0x00, 0x81, 0x03, 0x87, 0x00, 0x00, 0x02, 0x8C, 0x03, 0x00, 0x04, 0x8D, 0x00, 0x00, 0x01,
+    0xA8, 0x00, 0x00, 0x03, 0x88, 0x00, 0x00, 0x07, 0x84, 0x03, 0x00, 0x04, 0x83, 0x00, 0x01, 0x06,
+    0x03, 0x82, 0x00, 0x81, 0x03, 0x87, 0x00, 0x00, 0x02, 0x8C, 0x03, 0x00, 0x04, 0x8D, 0x00, 0x00,
+    0x01, 0xA8, 0x00, 0x00, 0x03, 0x88, 0x00, 0x00, 0x07, 0x84, 0x03, 0x00, 0x04, 0x83, 0x00, 0x01,
+    0x06, 0x03, 0x82, 0x00, 0x81, 0x03, 0x87, 0x00, 0x00, 0x02, 0x8C, 0x03, 0x00, 0x04, 0xB5, 0x00,
+    0x01, 0x05, 0x03, 0x88, 0x00, 0x02, 0x02, 0x07, 0x05, 0x88, 0x00, 0x00, 0x04, 0x82, 0x00, 0x81,
+    0x03, 0x87, 0x00, 0x05, 0x03, 0x06, 0x00, 0x06, 0x03, 0x06, 0x81, 0x00, 0x06, 0x06, 0x03, 0x06,
+    0x00, 0x06, 0x03, 0x06, 0x8D, 0x00, 0x00, 0x01, 0x92, 0x00, 0x02, 0x06, 0x04, 0x06, 0x91, 0x00,
+    0x01, 0x05, 0x03, 0x88, 0x00, 0x02, 0x02, 0x07, 0x05, 0x88, 0x00, 0x00, 0x04, 0x82, 0x00, 0x81,
+    0x03, 0x87, 0x00, 0x05, 0x03, 0x06, 0x00, 0x06, 0x03, 0x06, 0x81, 0x00, 0x06, 0x06, 0x03, 0x06,
+    0x00, 0x06, 0x03, 0x06, 0x8D, 0x00, 0x00, 0x01, 0xA7, 0x00, 0x01, 0x05, 0x03, 0x88, 0x00, 0x02,
+    0x02, 0x07, 0x05, 0x88, 0x00, 0x00, 0x04, 0x82, 0x00, 0x81, 0x03, 0x87, 0x00, 0x05, 0x03, 0x06,
+    0x00, 0x06, 0x03, 0x06, 0x81, 0x00, 0x06, 0x06, 0x03, 0x06, 0x00, 0x06, 0x03, 0x06, 0xB5, 0x00,
+    0x81, 0x07, 0x98, 0x00, 0x01, 0x03, 0x07, 0x87, 0x00, 0x00, 0x03, 0x82, 0x00, 0x00, 0x03, 0x83,
+    0x00, 0x00, 0x03, 0x82, 0x00, 0x00, 0x03, 0x8E, 0x00, 0x02, 0x01, 0x00, 0x04, 0x92, 0x03, 0x00,
+    0x04, 0x91, 0x00, 0x81, 0x07, 0x98, 0x00, 0x01, 0x03, 0x07, 0x87, 0x00, 0x00, 0x03, 0x82, 0x00,
+    0x00, 0x03, 0x83, 0x00, 0x00, 0x03, 0x82, 0x00, 0x00, 0x03, 0x8E, 0x00, 0x00, 0x01, 0xA7, 0x00,
+    0x81, 0x07, 0x98, 0x00, 0x01, 0x03, 0x07, 0x87, 0x00, 0x00, 0x03, 0x82, 0x00, 0x00, 0x03, 0x83,
+    0x00, 0x00, 0x03, 0x82, 0x00, 0x00, 0x03, 0xB1, 0x00, 0x06, 0x04, 0x0A, 0x09, 0x00, 0x06, 0x03,
+    0x05, 0x8E, 0x00, 0x01, 0x06, 0x0C, 0x87, 0x00, 0x01, 0x03, 0x05, 0x87, 0x00, 0x00, 0x03, 0x82,
+    0x00, 0x00, 0x03, 0x83, 0x00, 0x00, 0x03, 0x82, 0x00, 0x00, 0x03, 0x8E, 0x00, 0x00, 0x01, 0xA2,
+    0x00, 0x06, 0x04, 0x0A, 0x09, 0x00, 0x06, 0x03, 0x05, 0x8E, 0x00, 0x01, 0x06, 0x0C, 0x87, 0x00,
+    0x01, 0x03, 0x05, 0x87, 0x00, 0x00, 0x03, 0x82, 0x00, 0x00, 0x03, 0x83, 0x00, 0x00, 0x03, 0x82,
+    0x00, 0x00, 0x03, 0x8E, 0x00, 0x00, 0x01, 0x92, 0x00, 0x00, 0x05, 0x81, 0x07, 0x00, 0x05, 0x8B,
+    0x00, 0x06, 0x04, 0x0A, 0x09, 0x00, 0x06, 0x03, 0x05, 0x8E, 0x00, 0x01, 0x06, 0x0C, 0x87, 0x00,
+    0x01, 0x03, 0x05, 0x87, 0x00, 0x00, 0x03, 0x82, 0x00, 0x00, 0x03, 0x83, 0x00, 0x00, 0x03, 0x82,
+    0x00, 0x00, 0x03, 0xB2, 0x00, 0x01, 0x09, 0x08, 0x81, 0x03, 0x00, 0x02, 0x8B, 0x00, 0x01, 0x06,
+    0x0A, 0x81, 0x03, 0x01, 0x0A, 0x06, 0x86, 0x00, 0x01, 0x06, 0x03, 0x88, 0x00, 0x00, 0x03, 0x82,
+    0x00, 0x00, 0x03, 0x83, 0x00, 0x00, 0x03, 0x82, 0x00, 0x00, 0x03, 0x8E, 0x00, 0x00, 0x01, 0xA3,
+    0x00, 0x01, 0x09, 0x08, 0x81, 0x03, 0x00, 0x02, 0x8B, 0x00, 0x01, 0x06, 0x0A, 0x81, 0x03, 0x01,
+    0x0A, 0x06, 0x86, 0x00, 0x01, 0x06, 0x03, 0x88, 0x00, 0x00, 0x03, 0x82, 0x00, 0x00, 0x03, 0x83,
+    0x00, 0x00, 0x03, 0x82, 0x00, 0x00, 0x03, 0x8E, 0x00, 0x02, 0x01, 0x00, 0x04, 0x93, 0x03, 0x00,
+    0x04, 0x8C, 0x00, 0x01, 0x09, 0x08, 0x81, 0x03, 0x00, 0x02, 0x8B, 0x00, 0x01, 0x06, 0x0A, 0x81,
+    0x03, 0x01, 0x0A, 0x06, 0x86, 0x00, 0x01, 0x06, 0x03, 0x88, 0x00, 0x00, 0x03, 0x82, 0x00, 0x00,
+    0x03, 0x83, 0x00, 0x00, 0x03, 0x82, 0x00, 0x00, 0x03, 0xB3, 0x00, 0x02, 0x02, 0x07, 0x05, 0x89,
+    0x00, 0x00, 0x04, 0x81, 0x03, 0x01, 0x0A, 0x06, 0x88, 0x00, 0x00, 0x04, 0x81, 0x03, 0x00, 0x07,
+    0x87, 0x00, 0x06, 0x06, 0x03, 0x06, 0x00, 0x06, 0x03, 0x06, 0x81, 0x00, 0x05, 0x06, 0x03, 0x06,
+    0x00, 0x06, 0x03, 0x81, 0x06, 0x01, 0x04, 0x06, 0x8A, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x02, 0x02,
+    0x07, 0x05, 0x89, 0x00, 0x00, 0x04, 0x81, 0x03, 0x01, 0x0A, 0x06, 0x88, 0x00, 0x00, 0x04, 0x81,
+    0x03, 0x00, 0x07, 0x87, 0x00, 0x06, 0x06, 0x03, 0x06, 0x00, 0x06, 0x03, 0x06, 0x81, 0x00, 0x05,
+    0x06, 0x03, 0x06, 0x00, 0x06, 0x03, 0x81, 0x06, 0x01, 0x04, 0x06, 0x8A, 0x00, 0x00, 0x01, 0xA4,
+    0x00, 0x02, 0x02, 0x07, 0x05, 0x89, 0x00, 0x00, 0x04, 0x81, 0x03, 0x01, 0x0A, 0x06, 0x88, 0x00,
+    0x00, 0x04, 0x81, 0x03, 0x00, 0x07, 0x87, 0x00, 0x06, 0x06, 0x03, 0x06, 0x00, 0x06, 0x03, 0x06,
+    0x81, 0x00, 0x05, 0x06, 0x03, 0x06, 0x00, 0x06, 0x03, 0x81, 0x06, 0x01, 0x04, 0x06, 0xCB, 0x00,
+    0x02, 0x06, 0x04, 0x05, 0x84, 0x00, 0x00, 0x04, 0x93, 0x03, 0x00, 0x04, 0x8A, 0x00, 0x00, 0x01,
+    0xC0, 0x00, 0x02, 0x06, 0x04, 0x05, 0x84, 0x00, 0x00, 0x04, 0x93, 0x03, 0x00, 0x04, 0x8A, 0x00,
+    0x00, 0x01, 0xC0, 0x00, 0x02, 0x06, 0x04, 0x05, 0x84, 0x00, 0x00, 0x04, 0x93, 0x03, 0x00, 0x04,
+    0xF4, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00,
+    0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00,
+    0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01,
+    0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01,
+    0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00,
+    0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00,
+    0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00,
+    0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01,
+    0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01,
+    0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00,
+    0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00,
+    0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00,
+    0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01,
+    0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01,
+    0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00,
+    0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00,
+    0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00,
+    0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01,
+    0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01,
+    0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00,
+    0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00,
+    0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00,
+    0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01,
+    0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01,
+    0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00,
+    0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00,
+    0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00,
+    0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01,
+    0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01,
+    0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00,
+    0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00,
+    0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00,
+    0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01,
+    0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01,
+    0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00,
+    0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00,
+    0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00,
+    0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01,
+    0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01,
+    0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00,
+    0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00,
+    0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00,
+    0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01,
+    0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01,
+    0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00,
+    0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00,
+    0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00,
+    0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xE8, 0x00, 0xFF, 0x01, 0xFF, 0x01, 0xBF, 0x01, 0xEA, 0x00,
+    0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01,
+    0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01,
+    0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00,
+    0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00,
+    0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00,
+    0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01,
+    0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01,
+    0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00,
+    0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00,
+    0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00,
+    0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01,
+    0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01,
+    0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00,
+    0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00,
+    0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00,
+    0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01,
+    0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01,
+    0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00,
+    0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00,
+    0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00,
+    0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01,
+    0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01,
+    0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00,
+    0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00,
+    0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00,
+    0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01,
+    0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01,
+    0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00,
+    0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00,
+    0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00,
+    0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01,
+    0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01,
+    0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00,
+    0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00,
+    0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00,
+    0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01,
+    0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01,
+    0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00,
+    0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00,
+    0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00,
+    0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01,
+    0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01,
+    0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00,
+    0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00,
+    0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00,
+    0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01,
+    0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01,
+    0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00,
+    0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00,
+    0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00,
+    0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01,
+    0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01,
+    0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00,
+    0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00,
+    0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00,
+    0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01,
+    0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01,
+    0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00,
+    0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00,
+    0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00,
+    0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01,
+    0xFF, 0x00, 0xD3, 0x00, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x01, 0xE8, 0x00, 0xFF, 0x01, 0xFF, 0x01,
+    0xBF, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xBF, 0x00, 0x00, 0x0F,
+    0x82, 0x10, 0x00, 0x11, 0x84, 0x00, 0x00, 0x0F, 0x82, 0x10, 0x00, 0x0F, 0xC2, 0x00, 0x00, 0x11,
+    0x89, 0x10, 0x00, 0x11, 0x88, 0x00, 0x02, 0x11, 0x10, 0x11, 0xFF, 0x00, 0xD6, 0x00, 0x00, 0x12,
+    0x82, 0x10, 0x00, 0x13, 0x84, 0x00, 0x02, 0x12, 0x10, 0x12, 0xC3, 0x00, 0x04, 0x10, 0x14, 0x13,
+    0x00, 0x12, 0x81, 0x10, 0x00, 0x12, 0x81, 0x00, 0x02, 0x12, 0x10, 0x13, 0x87, 0x00, 0x82, 0x10,
+    0xFF, 0x00, 0xD7, 0x00, 0x82, 0x10, 0x00, 0x15, 0x85, 0x00, 0x00, 0x10, 0xA9, 0x00, 0x00, 0x0F,
+    0x98, 0x00, 0x02, 0x12, 0x16, 0x13, 0x82, 0x00, 0x81, 0x10, 0x83, 0x00, 0x81, 0x15, 0x87, 0x00,
+    0x02, 0x11, 0x10, 0x11, 0xFF, 0x00, 0xD7, 0x00, 0x01, 0x10, 0x17, 0x81, 0x10, 0x85, 0x00, 0x00,
+    0x10, 0xA9, 0x00, 0x00, 0x10, 0x98, 0x00, 0x01, 0x16, 0x12, 0x83, 0x00, 0x81, 0x10, 0x83, 0x00,
+    0x01, 0x13, 0x10, 0xFF, 0x00, 0xE2, 0x00, 0x01, 0x10, 0x00, 0x81, 0x10, 0x00, 0x13, 0x84, 0x00,
+    0x00, 0x10, 0xA8, 0x00, 0x01, 0x13, 0x10, 0x98, 0x00, 0x00, 0x0F, 0x84, 0x00, 0x81, 0x10, 0x84,
+    0x00, 0x00, 0x0F, 0xFF, 0x00, 0xE2, 0x00, 0x04, 0x10, 0x00, 0x15, 0x10, 0x15, 0x84, 0x00, 0x00,
+    0x10, 0xA7, 0x00, 0x02, 0x18, 0x14, 0x10, 0x9E, 0x00, 0x81, 0x10, 0xFF, 0x00, 0xE8, 0x00, 0x02,
+    0x10, 0x00, 0x13, 0x81, 0x10, 0x00, 0x13, 0x83, 0x00, 0x00, 0x10, 0xA6, 0x00, 0x01, 0x13, 0x14,
+    0x81, 0x10, 0x00, 0x12, 0x9D, 0x00, 0x81, 0x10, 0x8D, 0x00, 0x01, 0x12, 0x0F, 0x88, 0x00, 0x01,
+    0x12, 0x0F, 0xFF, 0x00, 0xCD, 0x00, 0x00, 0x10, 0x81, 0x00, 0x02, 0x15, 0x10, 0x15, 0x83, 0x00,
+    0x00, 0x10, 0x87, 0x00, 0x01, 0x12, 0x16, 0x82, 0x10, 0x01, 0x15, 0x18, 0x85, 0x00, 0x00, 0x0F,
+    0x83, 0x10, 0x02, 0x0F, 0x00, 0x0F, 0x82, 0x10, 0x00, 0x0F, 0x83, 0x00, 0x00, 0x0F, 0x88, 0x10,
+    0x00, 0x0F, 0x99, 0x00, 0x81, 0x10, 0x89, 0x00, 0x00, 0x0F, 0x84, 0x10, 0x87, 0x00, 0x00, 0x0F,
+    0x81, 0x10, 0x09, 0x17, 0x16, 0x10, 0x15, 0x13, 0x12, 0x16, 0x10, 0x15, 0x18, 0x86, 0x00, 0x01,
+    0x12, 0x16, 0x82, 0x10, 0x01, 0x15, 0x18, 0x89, 0x00, 0x00, 0x18, 0x81, 0x15, 0x00, 0x18, 0xFF,
+    0x00, 0xA7, 0x00, 0x00, 0x10, 0x81, 0x00, 0x00, 0x13, 0x81, 0x10, 0x00, 0x13, 0x82, 0x00, 0x00,
+    0x10, 0x85, 0x00, 0x03, 0x18, 0x15, 0x16, 0x12, 0x81, 0x00, 0x00, 0x13, 0x81, 0x14, 0x00, 0x18,
+    0x85, 0x00, 0x00, 0x12, 0x82, 0x10, 0x00, 0x12, 0x81, 0x00, 0x02, 0x17, 0x16, 0x12, 0x87, 0x00,
+    0x00, 0x12, 0x81, 0x10, 0x00, 0x12, 0x9D, 0x00, 0x81, 0x10, 0x8C, 0x00, 0x00, 0x12, 0x81, 0x10,
+    0x87, 0x00, 0x00, 0x12, 0x81, 0x10, 0x00, 0x16, 0x81, 0x12, 0x81, 0x10, 0x00, 0x16, 0x81, 0x12,
+    0x01, 0x10, 0x15, 0x84, 0x00, 0x03, 0x18, 0x15, 0x16, 0x12, 0x81, 0x00, 0x00, 0x13, 0x81, 0x14,
+    0x00, 0x18, 0x88, 0x00, 0x00, 0x15, 0x81, 0x10, 0x00, 0x15, 0xFF, 0x00, 0xA7, 0x00, 0x00, 0x10,
+    0x82, 0x00, 0x02, 0x15, 0x10, 0x15, 0x82, 0x00, 0x00, 0x10, 0x85, 0x00, 0x02, 0x15, 0x14, 0x13,
+    0x83, 0x00, 0x02, 0x18, 0x14, 0x15, 0x86, 0x00, 0x00, 0x15, 0x81, 0x10, 0x00, 0x13, 0x81, 0x00,
+    0x01, 0x16, 0x12, 0x89, 0x00, 0x81, 0x10, 0x9E, 0x00, 0x81, 0x10, 0x8D, 0x00, 0x81, 0x10, 0x88,
+    0x00, 0x81, 0x10, 0x00, 0x12, 0x81, 0x00, 0x81, 0x10, 0x00, 0x12, 0x81, 0x00, 0x81, 0x10, 0x84,
+    0x00, 0x02, 0x15, 0x14, 0x13, 0x83, 0x00, 0x02, 0x18, 0x14, 0x15, 0x88, 0x00, 0x00, 0x15, 0x81,
+    0x10, 0x00, 0x15, 0xFF, 0x00, 0xA7, 0x00, 0x00, 0x10, 0x82, 0x00, 0x00, 0x13, 0x81, 0x10, 0x00,
+    0x13, 0x81, 0x00, 0x00, 0x10, 0x84, 0x00, 0x02, 0x13, 0x10, 0x13, 0x85, 0x00, 0x02, 0x13, 0x10,
+    0x13, 0x85, 0x00, 0x06, 0x18, 0x14, 0x10, 0x15, 0x00, 0x12, 0x16, 0x8A, 0x00, 0x81, 0x10, 0x9E,
+    0x00, 0x81, 0x10, 0x8D, 0x00, 0x81, 0x10, 0x88, 0x00, 0x81, 0x10, 0x82, 0x00, 0x81, 0x10, 0x82,
+    0x00, 0x81, 0x10, 0x83, 0x00, 0x02, 0x13, 0x10, 0x13, 0x85, 0x00, 0x02, 0x13, 0x10, 0x13, 0x87,
+    0x00, 0x00, 0x18, 0x81, 0x15, 0x00, 0x18, 0xFF, 0x00, 0xA7, 0x00, 0x00, 0x10, 0x83, 0x00, 0x02,
+    0x15, 0x10, 0x15, 0x81, 0x00, 0x00, 0x10, 0x84, 0x00, 0x01, 0x15, 0x10, 0x87, 0x00, 0x01, 0x10,
+    0x15, 0x86, 0x00, 0x00, 0x13, 0x81, 0x10, 0x02, 0x19, 0x14, 0x12, 0x8A, 0x00, 0x81, 0x10, 0x9E,
+    0x00, 0x81, 0x10, 0x8D, 0x00, 0x81, 0x10, 0x88, 0x00, 0x81, 0x10, 0x82, 0x00, 0x81, 0x10, 0x82,
+    0x00, 0x81, 0x10, 0x83, 0x00, 0x01, 0x15, 0x10, 0x87, 0x00, 0x01, 0x10, 0x15, 0xFF, 0x00, 0xB3,
+    0x00, 0x00, 0x10, 0x83, 0x00, 0x00, 0x13, 0x81, 0x10, 0x02, 0x13, 0x00, 0x10, 0x84, 0x00, 0x81,
+    0x10, 0x00, 0x12, 0x85, 0x00, 0x00, 0x12, 0x81, 0x10, 0x87, 0x00, 0x03, 0x15, 0x10, 0x11, 0x19,
+    0x8B, 0x00, 0x81, 0x10, 0x9E, 0x00, 0x81, 0x10, 0x8D, 0x00, 0x81, 0x10, 0x88, 0x00, 0x81, 0x10,
+    0x82, 0x00, 0x81, 0x10, 0x82, 0x00, 0x81, 0x10, 0x83, 0x00, 0x81, 0x10, 0x00, 0x12, 0x85, 0x00,
+    0x00, 0x12, 0x81, 0x10, 0xFF, 0x00, 0xB3, 0x00, 0x00, 0x10, 0x84, 0x00, 0x04, 0x15, 0x10, 0x15,
+    0x00, 0x10, 0x84, 0x00, 0x8A, 0x10, 0x00, 0x11, 0x87, 0x00, 0x00, 0x13, 0x81, 0x10, 0x00, 0x11,
+    0x8B, 0x00, 0x81, 0x10, 0x9E, 0x00, 0x81, 0x10, 0x8D, 0x00, 0x81, 0x10, 0x88, 0x00, 0x81, 0x10,
+    0x82, 0x00, 0x81, 0x10, 0x82, 0x00, 0x81, 0x10, 0x83, 0x00, 0x8A, 0x10, 0x00, 0x11, 0xFF, 0x00,
+    0xB3, 0x00, 0x00, 0x10, 0x84, 0x00, 0x00, 0x13, 0x81, 0x10, 0x01, 0x17, 0x10, 0x84, 0x00, 0x81,
+    0x10, 0x00, 0x12, 0x90, 0x00, 0x01, 0x1A, 0x1B, 0x81, 0x10, 0x00, 0x13, 0x8A, 0x00, 0x81, 0x10,
+    0x9E, 0x00, 0x81, 0x10, 0x8D, 0x00, 0x81, 0x10, 0x88, 0x00, 0x81, 0x10, 0x82, 0x00, 0x81, 0x10,
+    0x82, 0x00, 0x81, 0x10, 0x83, 0x00, 0x81, 0x10, 0x00, 0x12, 0xFF, 0x00, 0xBC, 0x00, 0x00, 0x10,
+    0x85, 0x00, 0x00, 0x15, 0x82, 0x10, 0x84, 0x00, 0x81, 0x10, 0x90, 0x00, 0x05, 0x13, 0x16, 0x19,
+    0x15, 0x10, 0x15, 0x8A, 0x00, 0x81, 0x10, 0x9E, 0x00, 0x81, 0x10, 0x8D, 0x00, 0x81, 0x10, 0x88,
+    0x00, 0x81, 0x10, 0x82, 0x00, 0x81, 0x10, 0x82, 0x00, 0x81, 0x10, 0x83, 0x00, 0x81, 0x10, 0xFF,
+    0x00, 0xBD, 0x00, 0x00, 0x10, 0x85, 0x00, 0x00, 0x13, 0x82, 0x10, 0x84, 0x00, 0x02, 0x15, 0x10,
+    0x13, 0x8F, 0x00, 0x81, 0x15, 0x04, 0x00, 0x18, 0x14, 0x10, 0x13, 0x89, 0x00, 0x81, 0x10, 0x9E,
+    0x00, 0x81, 0x10, 0x8D, 0x00, 0x81, 0x10, 0x88, 0x00, 0x81, 0x10, 0x82, 0x00, 0x81, 0x10, 0x82,
+    0x00, 0x81, 0x10, 0x83, 0x00, 0x02, 0x15, 0x10, 0x13, 0xFF, 0x00, 0xBC, 0x00, 0x00, 0x10, 0x86,
+    0x00, 0x82, 0x10, 0x84, 0x00, 0x02, 0x13, 0x10, 0x15, 0x86, 0x00, 0x01, 0x12, 0x14, 0x85, 0x00,
+    0x02, 0x12, 0x16, 0x13, 0x81, 0x00, 0x02, 0x13, 0x10, 0x15, 0x89, 0x00, 0x81, 0x10, 0x84, 0x00,
+    0x00, 0x0F, 0x98, 0x00, 0x81, 0x10, 0x8D, 0x00, 0x81, 0x10, 0x88, 0x00, 0x81, 0x10, 0x82, 0x00,
+    0x81, 0x10, 0x82, 0x00, 0x81, 0x10, 0x83, 0x00, 0x02, 0x13, 0x10, 0x15, 0x86, 0x00, 0x01, 0x12,
+    0x14, 0x87, 0x00, 0x00, 0x18, 0x81, 0x15, 0x00, 0x18, 0xFF, 0x00, 0xA7, 0x00, 0x00, 0x10, 0x86,
+    0x00, 0x00, 0x15, 0x81, 0x10, 0x85, 0x00, 0x02, 0x15, 0x10, 0x12, 0x84, 0x00, 0x02, 0x12, 0x16,
+    0x12, 0x84, 0x00, 0x02, 0x13, 0x16, 0x12, 0x83, 0x00, 0x02, 0x11, 0x10, 0x13, 0x88, 0x00, 0x02,
+    0x15, 0x10, 0x13, 0x82, 0x00, 0x01, 0x12, 0x16, 0x98, 0x00, 0x81, 0x10, 0x8D, 0x00, 0x81, 0x10,
+    0x88, 0x00, 0x81, 0x10, 0x82, 0x00, 0x81, 0x10, 0x82, 0x00, 0x81, 0x10, 0x84, 0x00, 0x02, 0x15,
+    0x10, 0x12, 0x84, 0x00, 0x02, 0x12, 0x16, 0x12, 0x87, 0x00, 0x00, 0x15, 0x81, 0x10, 0x00, 0x15,
+    0xFF, 0x00, 0xA6, 0x00, 0x02, 0x12, 0x10, 0x12, 0x85, 0x00, 0x00, 0x13, 0x81, 0x10, 0x85, 0x00,
+    0x04, 0x18, 0x15, 0x10, 0x15, 0x13, 0x81, 0x00, 0x02, 0x12, 0x16, 0x11, 0x84, 0x00, 0x03, 0x13,
+    0x14, 0x10, 0x12, 0x83, 0x00, 0x03, 0x17, 0x10, 0x14, 0x13, 0x87, 0x00, 0x00, 0x18, 0x81, 0x14,
+    0x04, 0x13, 0x00, 0x12, 0x0F, 0x12, 0x97, 0x00, 0x00, 0x12, 0x81, 0x10, 0x00, 0x12, 0x8B, 0x00,
+    0x00, 0x12, 0x81, 0x10, 0x00, 0x12, 0x86, 0x00, 0x00, 0x12, 0x81, 0x10, 0x02, 0x12, 0x00, 0x12,
+    0x81, 0x10, 0x02, 0x12, 0x00, 0x12, 0x81, 0x10, 0x00, 0x12, 0x83, 0x00, 0x04, 0x18, 0x15, 0x10,
+    0x15, 0x13, 0x81, 0x00, 0x02, 0x12, 0x16, 0x11, 0x88, 0x00, 0x00, 0x15, 0x81, 0x10, 0x00, 0x15,
+    0xFF, 0x00, 0xA5, 0x00, 0x00, 0x0F, 0x82, 0x10, 0x00, 0x0F, 0x85, 0x00, 0x81, 0x11, 0x87, 0x00,
+    0x01, 0x13, 0x15, 0x82, 0x10, 0x01, 0x16, 0x12, 0x84, 0x00, 0x00, 0x0F, 0x82, 0x10, 0x00, 0x0F,
+    0x82, 0x00, 0x00, 0x0F, 0x83, 0x10, 0x00, 0x0F, 0x87, 0x00, 0x01, 0x18, 0x15, 0x81, 0x10, 0x01,
+    0x16, 0x12, 0x97, 0x00, 0x00, 0x0F, 0x83, 0x10, 0x00, 0x0F, 0x87, 0x00, 0x00, 0x0F, 0x87, 0x10,
+    0x00, 0x0F, 0x83, 0x00, 0x00, 0x0F, 0x81, 0x10, 0x02, 0x0F, 0x00, 0x0F, 0x81, 0x10, 0x02, 0x0F,
+    0x00, 0x0F, 0x81, 0x10, 0x00, 0x0F, 0x85, 0x00, 0x01, 0x13, 0x15, 0x82, 0x10, 0x01, 0x16, 0x12,
+    0x89, 0x00, 0x00, 0x18, 0x81, 0x15, 0x00, 0x18, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xE5, 0x00,
+};
+
+const lcd_picture_rle_t page0_bg_rle =
+{
+    320, 240, 28, page0_bg_palette, 5642, page0_bg_data,
+};
+
+/* page1_bg: 320x240, 83 colors, 153600 -> 7292 bytes */
+static const uint16_t page1_bg_palette[83] =
+{
+    0xF7BE, 0xFFFF, 0xFFDF, 0x0000, 0x18C3, 0x39C7, 0xF79E, 0x31A6,
+    0x0020, 0x9492, 0xEF7D, 0xD69A, 0xCE79, 0x39E7, 0x0841, 0xC638,
+    0x528A, 0x9CD3, 0x1082, 0xBDD7, 0x0861, 0xC618, 0xA514, 0xEF5D,
+    0xE73C, 0x6B4D, 0x2945, 0x2104, 0x2124, 0x10A2, 0x9CF3, 0xB596,
+    0x6B6D, 0x2965, 0xBDF7, 0x5ACB, 0x94B2, 0xCE59, 0x8430, 0x632C,
+    0x8410, 0xB5B6, 0xAD55, 0xAD75, 0xDEDB, 0xE71C, 0x18E3, 0x5AEB,
+    0xDEFB, 0x4228, 0x630C, 0x8C71, 0x4A49, 0x0820, 0x738E, 0x4A69,
+    0xAD95, 0xE75C, 0xDF1B, 0xF7DF, 0xD6BA, 0xA534, 0x8C51, 0x7BCF,
+    0x3186, 0x73AE, 0x52AA, 0x7BEF, 0x4208, 0xAD96, 0xD6DA, 0xDF1C,
+    0xD6DB, 0xD58A, 0xBC40, 0xCD06, 0xEEF7, 0xE6B5, 0xC482, 0xCD48,
+    0xC4C4, 0xF77B, 0xEF39,
+};
+
+static const uint8_t page1_bg_data[7126] =
+{
+    0xBF, 0x00, 0x93, 0x01, 0xBF, 0x00, 0xE7, 0x01, 0xBF, 0x00, 0x83, 0x01, 0xBF, 0x00, 0x93, 0x01,
+    0xAC, 0x00, 0x00, 0x02, 0x83, 0x03, 0x8D, 0x00, 0xE7, 0x01, 0xBF, 0x00, 0x83, 0x01, 0xBF, 0x00,
+    0x93, 0x01, 0xAC, 0x00, 0x85, 0x03, 0x8C, 0x00, 0xE7, 0x01, 0xBF, 0x00, 0x83, 0x01, 0xBF, 0x00,
+    0x93, 0x01, 0xAB, 0x00, 0x87, 0x03, 0x8B, 0x00, 0xAB, 0x01, 0x00, 0x04, 0x84, 0x03, 0x01, 0x05,
+    0x02, 0xB3, 0x01, 0xBF, 0x00, 0x83, 0x01, 0xA0, 0x00, 0x01, 0x06, 0x02, 0x9C, 0x00, 0x93, 0x01,
+    0xAA, 0x00, 0x00, 0x07, 0x87, 0x03, 0x00, 0x05, 0x8A, 0x00, 0xA9, 0x01, 0x89, 0x03, 0x00, 0x08,
+    0xB2, 0x01, 0xBF, 0x00, 0x83, 0x01, 0x9C, 0x00, 0x01, 0x06, 0x09, 0x83, 0x03, 0x03, 0x09, 0x0A,
+    0x00, 0x02, 0x81, 0x00, 0x00, 0x02, 0x95, 0x00, 0x93, 0x01, 0xA9, 0x00, 0x00, 0x0B, 0x89, 0x03,
+    0x00, 0x0C, 0x89, 0x00, 0xA8, 0x01, 0x87, 0x03, 0x81, 0x08, 0x82, 0x03, 0xB1, 0x01, 0xBF, 0x00,
+    0x83, 0x01, 0x9C, 0x00, 0x00, 0x02, 0x88, 0x03, 0x01, 0x0D, 0x00, 0x81, 0x06, 0x94, 0x00, 0x93,
+    0x01, 0xA9, 0x00, 0x8B, 0x03, 0x00, 0x02, 0x88, 0x00, 0xA7, 0x01, 0x00, 0x0E, 0x81, 0x03, 0x00,
+    0x0F, 0x85, 0x01, 0x01, 0x02, 0x10, 0x81, 0x03, 0x00, 0x11, 0xB0, 0x01, 0xBF, 0x00, 0x83, 0x01,
+    0x9D, 0x00, 0x00, 0x0E, 0x8A, 0x03, 0x01, 0x0C, 0x06, 0x93, 0x00, 0x93, 0x01, 0xA8, 0x00, 0x8D,
+    0x03, 0x88, 0x00, 0xA7, 0x01, 0x81, 0x03, 0x00, 0x07, 0x88, 0x01, 0x00, 0x08, 0x81, 0x03, 0xB0,
+    0x01, 0xBF, 0x00, 0x83, 0x01, 0x9C, 0x00, 0x04, 0x02, 0x06, 0x10, 0x05, 0x12, 0x88, 0x03, 0x01,
+    0x0E, 0x13, 0x92, 0x00, 0x93, 0x01, 0xA7, 0x00, 0x86, 0x03, 0x00, 0x08, 0x86, 0x03, 0x00, 0x08,
+    0x87, 0x00, 0xA7, 0x01, 0x81, 0x03, 0x89, 0x01, 0x00, 0x02, 0x81, 0x03, 0x82, 0x01, 0x00, 0x02,
+    0xAC, 0x01, 0xBF, 0x00, 0x83, 0x01, 0x9E, 0x00, 0x03, 0x02, 0x00, 0x06, 0x00, 0x81, 0x06, 0x02,
+    0x00, 0x14, 0x0E, 0x84, 0x03, 0x01, 0x08, 0x01, 0x90, 0x00, 0x93, 0x01, 0xA6, 0x00, 0x00, 0x15,
+    0x86, 0x03, 0x81, 0x00, 0x00, 0x08, 0x85, 0x03, 0x00, 0x16, 0x86, 0x00, 0xA0, 0x01, 0x00, 0x06,
+    0x85, 0x01, 0x81, 0x03, 0x8A, 0x01, 0x81, 0x03, 0x81, 0x01, 0x02, 0x06, 0x00, 0x02, 0xAB, 0x01,
+    0x98, 0x00, 0x00, 0x17, 0x9D, 0x00, 0x00, 0x18, 0x86, 0x00, 0x83, 0x01, 0xA5, 0x00, 0x02, 0x02,
+    0x0A, 0x02, 0x84, 0x03, 0x02, 0x12, 0x19, 0x06, 0x8E, 0x00, 0x93, 0x01, 0xA6, 0x00, 0x86, 0x03,
+    0x82, 0x00, 0x00, 0x06, 0x86, 0x03, 0x86, 0x00, 0x9E, 0x01, 0x04, 0x1A, 0x03, 0x1B, 0x1C, 0x02,
+    0x83, 0x01, 0x81, 0x03, 0x8A, 0x01, 0x81, 0x03, 0x81, 0x01, 0x82, 0x06, 0xAB, 0x01, 0x94, 0x00,
+    0x02, 0x0A, 0x06, 0x00, 0x81, 0x17, 0x99, 0x00, 0x03, 0x0A, 0x00, 0x17, 0x06, 0x87, 0x00, 0x83,
+    0x01, 0x9D, 0x00, 0x00, 0x0A, 0x81, 0x02, 0x01, 0x00, 0x0A, 0x85, 0x00, 0x01, 0x02, 0x00, 0x84,
+    0x03, 0x00, 0x0E, 0x8E, 0x00, 0x93, 0x01, 0x9A, 0x00, 0x00, 0x14, 0x81, 0x03, 0x00, 0x08, 0x86,
+    0x00, 0x00, 0x08, 0x85, 0x03, 0x84, 0x00, 0x00, 0x18, 0x86, 0x03, 0x85, 0x00, 0x9E, 0x01, 0x03,
+    0x1B, 0x1D, 0x03, 0x12, 0x84, 0x01, 0x81, 0x03, 0x8A, 0x01, 0x81, 0x03, 0x82, 0x01, 0x00, 0x0A,
+    0xAC, 0x01, 0x92, 0x00, 0x05, 0x0A, 0x00, 0x02, 0x06, 0x00, 0x0A, 0x97, 0x00, 0x01, 0x17, 0x0A,
+    0x82, 0x00, 0x81, 0x06, 0x87, 0x00, 0x83, 0x01, 0x9C, 0x00, 0x01, 0x06, 0x14, 0x85, 0x03, 0x02,
+    0x1E, 0x00, 0x02, 0x82, 0x00, 0x02, 0x0A, 0x1F, 0x08, 0x82, 0x03, 0x01, 0x08, 0x06, 0x8C, 0x00,
+    0x93, 0x01, 0x99, 0x00, 0x00, 0x0E, 0x84, 0x03, 0x84, 0x00, 0x00, 0x20, 0x85, 0x03, 0x00, 0x21,
+    0x81, 0x00, 0x01, 0x22, 0x03, 0x81, 0x00, 0x00, 0x1C, 0x85, 0x03, 0x00, 0x05, 0x84, 0x00, 0x9E,
+    0x01, 0x04, 0x08, 0x1D, 0x08, 0x03, 0x02, 0x83, 0x01, 0x81, 0x03, 0x8A, 0x01, 0x81, 0x03, 0x81,
+    0x01, 0x00, 0x02, 0xAD, 0x01, 0x8E, 0x00, 0x02, 0x17, 0x06, 0x00, 0x81, 0x06, 0x00, 0x0A, 0x98,
+    0x00, 0x05, 0x18, 0x17, 0x00, 0x17, 0x02, 0x0A, 0x8B, 0x00, 0x83, 0x01, 0x9C, 0x00, 0x00, 0x0A,
+    0x87, 0x03, 0x03, 0x08, 0x0E, 0x17, 0x06, 0x81, 0x00, 0x81, 0x06, 0x00, 0x14, 0x82, 0x03, 0x01,
+    0x0E, 0x0A, 0x8B, 0x00, 0x93, 0x01, 0x98, 0x00, 0x00, 0x23, 0x85, 0x03, 0x00, 0x1D, 0x83, 0x00,
+    0x85, 0x03, 0x01, 0x08, 0x02, 0x81, 0x00, 0x00, 0x08, 0x81, 0x03, 0x81, 0x00, 0x85, 0x03, 0x00,
+    0x08, 0x84, 0x00, 0x9C, 0x01, 0x05, 0x02, 0x00, 0x01, 0x02, 0x01, 0x02, 0x84, 0x01, 0x81, 0x03,
+    0x82, 0x01, 0x00, 0x06, 0x82, 0x03, 0x00, 0x00, 0x82, 0x01, 0x03, 0x08, 0x03, 0x01, 0x00, 0xAE,
+    0x01, 0x8B, 0x00, 0x04, 0x06, 0x00, 0x02, 0x17, 0x0A, 0x97, 0x00, 0x06, 0x06, 0x00, 0x0A, 0x02,
+    0x00, 0x0A, 0x06, 0x8F, 0x00, 0x83, 0x01, 0x8C, 0x00, 0x02, 0x19, 0x0E, 0x06, 0x8C, 0x00, 0x00,
+    0x06, 0x81, 0x08, 0x88, 0x03, 0x01, 0x1D, 0x0A, 0x82, 0x00, 0x00, 0x01, 0x81, 0x08, 0x81, 0x03,
+    0x01, 0x0E, 0x02, 0x8A, 0x00, 0x93, 0x01, 0x97, 0x00, 0x00, 0x0B, 0x87, 0x03, 0x00, 0x24, 0x81,
+    0x00, 0x86, 0x03, 0x83, 0x00, 0x83, 0x03, 0x01, 0x00, 0x06, 0x85, 0x03, 0x00, 0x08, 0x83, 0x00,
+    0x9C, 0x01, 0x81, 0x00, 0x00, 0x02, 0x87, 0x01, 0x81, 0x03, 0x82, 0x01, 0x84, 0x03, 0x82, 0x01,
+    0x02, 0x14, 0x0E, 0x06, 0xAF, 0x01, 0x86, 0x00, 0x81, 0x17, 0x01, 0x00, 0x0A, 0x99, 0x00, 0x81,
+    0x17, 0x02, 0x18, 0x00, 0x0A, 0x95, 0x00, 0x83, 0x01, 0x8B, 0x00, 0x00, 0x06, 0x82, 0x03, 0x00,
+    0x0A, 0x90, 0x00, 0x04, 0x01, 0x25, 0x0E, 0x03, 0x08, 0x83, 0x03, 0x00, 0x26, 0x82, 0x00, 0x00,
+    0x06, 0x81, 0x08, 0x81, 0x03, 0x01, 0x12, 0x0A, 0x89, 0x00, 0x93, 0x01, 0x96, 0x00, 0x01, 0x02,
+    0x08, 0x88, 0x03, 0x01, 0x06, 0x25, 0x85, 0x03, 0x00, 0x27, 0x84, 0x00, 0x82, 0x03, 0x02, 0x1E,
+    0x00, 0x28, 0x85, 0x03, 0x00, 0x1F, 0x82, 0x00, 0x9D, 0x01, 0x00, 0x02, 0x88, 0x01, 0x81, 0x03,
+    0x82, 0x01, 0x84, 0x03, 0x82, 0x01, 0x81, 0x08, 0xB0, 0x01, 0x83, 0x00, 0x00, 0x06, 0x81, 0x00,
+    0x81, 0x06, 0x00, 0x0A, 0x9B, 0x00, 0x00, 0x0A, 0x98, 0x00, 0x83, 0x01, 0x8B, 0x00, 0x01, 0x0A,
+    0x0E, 0x81, 0x03, 0x00, 0x08, 0x94, 0x00, 0x01, 0x29, 0x08, 0x83, 0x03, 0x02, 0x0E, 0x0A, 0x02,
+    0x81, 0x00, 0x00, 0x08, 0x82, 0x03, 0x00, 0x2A, 0x89, 0x00, 0x93, 0x01, 0x96, 0x00, 0x00, 0x08,
+    0x89, 0x03, 0x00, 0x08, 0x86, 0x03, 0x85, 0x00, 0x00, 0x0C, 0x82, 0x03, 0x01, 0x06, 0x00, 0x86,
+    0x03, 0x00, 0x02, 0x81, 0x00, 0x9F, 0x01, 0x02, 0x1F, 0x2B, 0x2C, 0x84, 0x01, 0x81, 0x03, 0x82,
+    0x01, 0x84, 0x03, 0x82, 0x01, 0x81, 0x03, 0xB0, 0x01, 0x85, 0x00, 0x00, 0x06, 0x88, 0x00, 0x01,
+    0x03, 0x08, 0x92, 0x00, 0x00, 0x06, 0x99, 0x00, 0x83, 0x01, 0x8C, 0x00, 0x00, 0x18, 0x82, 0x03,
+    0x01, 0x0E, 0x17, 0x94, 0x00, 0x00, 0x28, 0x84, 0x03, 0x01, 0x00, 0x02, 0x81, 0x00, 0x83, 0x03,
+    0x00, 0x18, 0x88, 0x00, 0x93, 0x01, 0x95, 0x00, 0x00, 0x08, 0x91, 0x03, 0x87, 0x00, 0x00, 0x08,
+    0x82, 0x03, 0x81, 0x00, 0x00, 0x08, 0x84, 0x03, 0x00, 0x23, 0x81, 0x00, 0x9E, 0x01, 0x83, 0x03,
+    0x84, 0x01, 0x81, 0x03, 0x82, 0x01, 0x84, 0x03, 0x82, 0x01, 0x81, 0x03, 0xB0, 0x01, 0x8D, 0x00,
+    0x01, 0x2D, 0x19, 0x81, 0x01, 0x00, 0x13, 0x89, 0x00, 0x03, 0x06, 0x1B, 0x03, 0x10, 0x9E, 0x00,
+    0x83, 0x01, 0x8D, 0x00, 0x01, 0x2D, 0x14, 0x81, 0x03, 0x02, 0x0E, 0x06, 0x02, 0x83, 0x00, 0x83,
+    0x02, 0x04, 0x00, 0x06, 0x02, 0x00, 0x02, 0x86, 0x00, 0x01, 0x06, 0x08, 0x82, 0x03, 0x02, 0x14,
+    0x00, 0x06, 0x81, 0x00, 0x00, 0x08, 0x81, 0x03, 0x00, 0x0E, 0x88, 0x00, 0x93, 0x01, 0x94, 0x00,
+    0x00, 0x12, 0x86, 0x03, 0x00, 0x08, 0x89, 0x03, 0x00, 0x0E, 0x88, 0x00, 0x82, 0x03, 0x81, 0x00,
+    0x00, 0x2E, 0x85, 0x03, 0x01, 0x06, 0x00, 0x9E, 0x01, 0x83, 0x03, 0x84, 0x01, 0x81, 0x03, 0x82,
+    0x01, 0x84, 0x03, 0x82, 0x01, 0x81, 0x03, 0xB0, 0x01, 0x8B, 0x00, 0x00, 0x03, 0x86, 0x01, 0x00,
+    0x03, 0x87, 0x00, 0x83, 0x01, 0x00, 0x06, 0x8C, 0x00, 0x01, 0x08, 0x2F, 0x8E, 0x00, 0x83, 0x01,
+    0x8E, 0x00, 0x00, 0x30, 0x82, 0x03, 0x01, 0x0E, 0x06, 0x83, 0x00, 0x01, 0x02, 0x01, 0x81, 0x08,
+    0x83, 0x03, 0x05, 0x08, 0x03, 0x31, 0x06, 0x17, 0x02, 0x83, 0x00, 0x00, 0x08, 0x82, 0x03, 0x05,
+    0x14, 0x06, 0x02, 0x00, 0x32, 0x0E, 0x81, 0x03, 0x00, 0x06, 0x87, 0x00, 0x93, 0x01, 0x93, 0x00,
+    0x00, 0x25, 0x86, 0x03, 0x81, 0x00, 0x88, 0x03, 0x00, 0x08, 0x81, 0x00, 0x81, 0x06, 0x00, 0x0A,
+    0x85, 0x00, 0x01, 0x08, 0x0A, 0x82, 0x00, 0x85, 0x03, 0x01, 0x33, 0x00, 0x9E, 0x01, 0x04, 0x02,
+    0x1D, 0x04, 0x27, 0x02, 0x83, 0x01, 0x81, 0x03, 0x82, 0x01, 0x84, 0x03, 0x82, 0x01, 0x81, 0x03,
+    0xB0, 0x01, 0x8B, 0x00, 0x81, 0x30, 0x86, 0x01, 0x87, 0x00, 0x00, 0x23, 0x82, 0x01, 0x8B, 0x00,
+    0x00, 0x08, 0x82, 0x01, 0x00, 0x29, 0x8D, 0x00, 0x83, 0x01, 0x8E, 0x00, 0x02, 0x02, 0x25, 0x08,
+    0x81, 0x03, 0x01, 0x34, 0x00, 0x81, 0x0A, 0x01, 0x13, 0x35, 0x8B, 0x03, 0x81, 0x06, 0x81, 0x00,
+    0x81, 0x06, 0x00, 0x0E, 0x82, 0x03, 0x03, 0x15, 0x0A, 0x17, 0x06, 0x82, 0x03, 0x01, 0x0E, 0x06,
+    0x86, 0x00, 0x93, 0x01, 0x87, 0x00, 0x82, 0x03, 0x00, 0x08, 0x87, 0x00, 0x86, 0x03, 0x83, 0x00,
+    0x87, 0x03, 0x00, 0x36, 0x81, 0x00, 0x04, 0x06, 0x0A, 0x06, 0x00, 0x0A, 0x84, 0x00, 0x04, 0x08,
+    0x03, 0x08, 0x00, 0x26, 0x85, 0x03, 0x00, 0x00, 0xA7, 0x01, 0x81, 0x03, 0x82, 0x01, 0x84, 0x03,
+    0x82, 0x01, 0x81, 0x03, 0xB0, 0x01, 0x8A, 0x00, 0x00, 0x1F, 0x81, 0x30, 0x86, 0x01, 0x88, 0x00,
+    0x02, 0x03, 0x27, 0x03, 0x8B, 0x00, 0x00, 0x30, 0x83, 0x01, 0x01, 0x03, 0x06, 0x8B, 0x00, 0x83,
+    0x01, 0x90, 0x00, 0x02, 0x25, 0x03, 0x12, 0x81, 0x00, 0x03, 0x17, 0x12, 0x03, 0x08, 0x8B, 0x03,
+    0x01, 0x08, 0x37, 0x82, 0x00, 0x01, 0x02, 0x06, 0x82, 0x08, 0x01, 0x1A, 0x2C, 0x81, 0x00, 0x00,
+    0x2D, 0x81, 0x03, 0x01, 0x08, 0x01, 0x86, 0x00, 0x93, 0x01, 0x86, 0x00, 0x85, 0x03, 0x85, 0x00,
+    0x86, 0x03, 0x00, 0x1E, 0x84, 0x00, 0x00, 0x08, 0x81, 0x03, 0x03, 0x08, 0x1D, 0x08, 0x03, 0x82,
+    0x00, 0x03, 0x06, 0x0A, 0x17, 0x0A, 0x85, 0x00, 0x82, 0x03, 0x81, 0x00, 0x00, 0x08, 0x84, 0x03,
+    0x00, 0x00, 0xA7, 0x01, 0x81, 0x03, 0x82, 0x01, 0x84, 0x03, 0x82, 0x01, 0x81, 0x03, 0xB0, 0x01,
+    0x8B, 0x00, 0x01, 0x22, 0x30, 0x86, 0x01, 0x88, 0x00, 0x00, 0x0A, 0x8D, 0x00, 0x01, 0x0C, 0x30,
+    0x84, 0x01, 0x00, 0x0B, 0x8A, 0x00, 0x83, 0x01, 0x90, 0x00, 0x02, 0x06, 0x01, 0x00, 0x81, 0x0A,
+    0x81, 0x08, 0x82, 0x03, 0x01, 0x08, 0x10, 0x81, 0x01, 0x04, 0x00, 0x06, 0x30, 0x14, 0x08, 0x83,
+    0x03, 0x01, 0x0E, 0x06, 0x81, 0x00, 0x03, 0x01, 0x00, 0x14, 0x08, 0x81, 0x14, 0x00, 0x01, 0x81,
+    0x00, 0x00, 0x0E, 0x82, 0x03, 0x86, 0x00, 0x93, 0x01, 0x85, 0x00, 0x00, 0x06, 0x85, 0x03, 0x00,
+    0x07, 0x83, 0x00, 0x00, 0x0E, 0x86, 0x03, 0x84, 0x00, 0x01, 0x0A, 0x28, 0x81, 0x1D, 0x05, 0x0E,
+    0x03, 0x0E, 0x03, 0x12, 0x02, 0x8A, 0x00, 0x00, 0x27, 0x81, 0x03, 0x02, 0x1A, 0x00, 0x34, 0x84,
+    0x03, 0x00, 0x34, 0xA7, 0x01, 0x81, 0x03, 0x82, 0x01, 0x84, 0x03, 0x82, 0x01, 0x81, 0x03, 0xB0,
+    0x01, 0x8B, 0x00, 0x04, 0x0D, 0x38, 0x30, 0x39, 0x01, 0x82, 0x30, 0x00, 0x03, 0x96, 0x00, 0x81,
+    0x30, 0x86, 0x01, 0x8A, 0x00, 0x83, 0x01, 0x92, 0x00, 0x03, 0x0A, 0x06, 0x04, 0x08, 0x81, 0x03,
+    0x02, 0x08, 0x00, 0x06, 0x86, 0x00, 0x01, 0x06, 0x20, 0x83, 0x03, 0x01, 0x0E, 0x06, 0x81, 0x00,
+    0x05, 0x06, 0x07, 0x1D, 0x08, 0x0E, 0x06, 0x81, 0x00, 0x00, 0x1E, 0x82, 0x03, 0x00, 0x02, 0x85,
+    0x00, 0x93, 0x01, 0x84, 0x00, 0x00, 0x02, 0x86, 0x03, 0x00, 0x08, 0x82, 0x00, 0x00, 0x18, 0x86,
+    0x03, 0x00, 0x02, 0x82, 0x00, 0x81, 0x0A, 0x03, 0x00, 0x0A, 0x04, 0x08, 0x81, 0x03, 0x00, 0x0E,
+    0x81, 0x03, 0x00, 0x10, 0x8B, 0x00, 0x81, 0x03, 0x82, 0x00, 0x85, 0x03, 0x9E, 0x01, 0x00, 0x08,
+    0x82, 0x03, 0x84, 0x01, 0x81, 0x03, 0x82, 0x01, 0x84, 0x03, 0x82, 0x01, 0x81, 0x03, 0xB0, 0x01,
+    0x8C, 0x00, 0x00, 0x22, 0x85, 0x30, 0x92, 0x00, 0x01, 0x01, 0x30, 0x81, 0x00, 0x00, 0x17, 0x81,
+    0x30, 0x00, 0x3A, 0x85, 0x01, 0x00, 0x2F, 0x89, 0x00, 0x83, 0x01, 0x92, 0x00, 0x01, 0x0A, 0x1D,
+    0x82, 0x03, 0x02, 0x1A, 0x06, 0x02, 0x89, 0x00, 0x00, 0x17, 0x82, 0x03, 0x01, 0x08, 0x1C, 0x83,
+    0x00, 0x00, 0x08, 0x81, 0x03, 0x00, 0x2E, 0x81, 0x00, 0x00, 0x02, 0x82, 0x03, 0x00, 0x2D, 0x85,
+    0x00, 0x93, 0x01, 0x84, 0x00, 0x00, 0x1B, 0x87, 0x03, 0x00, 0x08, 0x81, 0x00, 0x86, 0x03, 0x00,
+    0x06, 0x81, 0x00, 0x07, 0x0A, 0x00, 0x06, 0x00, 0x0A, 0x06, 0x00, 0x08, 0x84, 0x03, 0x00, 0x08,
+    0x90, 0x00, 0x85, 0x03, 0x9E, 0x01, 0x83, 0x03, 0x84, 0x01, 0x81, 0x03, 0x82, 0x01, 0x84, 0x03,
+    0x82, 0x01, 0x81, 0x03, 0xB0, 0x01, 0x8C, 0x00, 0x01, 0x0B, 0x0E, 0x81, 0x30, 0x02, 0x08, 0x1B,
+    0x0A, 0x91, 0x00, 0x81, 0x01, 0x00, 0x0A, 0x82, 0x00, 0x82, 0x30, 0x00, 0x3B, 0x82, 0x01, 0x02,
+    0x14, 0x01, 0x3C, 0x89, 0x00, 0x83, 0x01, 0x92, 0x00, 0x00, 0x08, 0x82, 0x03, 0x00, 0x19, 0x8E,
+    0x00, 0x00, 0x0E, 0x81, 0x03, 0x01, 0x08, 0x0A, 0x82, 0x00, 0x00, 0x31, 0x82, 0x03, 0x00, 0x06,
+    0x81, 0x00, 0x00, 0x0E, 0x81, 0x03, 0x00, 0x14, 0x85, 0x00, 0x93, 0x01, 0x83, 0x00, 0x01, 0x02,
+    0x08, 0x88, 0x03, 0x00, 0x11, 0x83, 0x03, 0x04, 0x14, 0x12, 0x03, 0x29, 0x00, 0x81, 0x06, 0x81,
+    0x00, 0x00, 0x06, 0x84, 0x00, 0x85, 0x03, 0x00, 0x08, 0x8F, 0x00, 0x85, 0x03, 0x9E, 0x01, 0x00,
+    0x14, 0x82, 0x03, 0x84, 0x01, 0x81, 0x03, 0x82, 0x01, 0x84, 0x03, 0x82, 0x01, 0x81, 0x03, 0xB0,
+    0x01, 0x8D, 0x00, 0x00, 0x02, 0x81, 0x00, 0x01, 0x36, 0x00, 0x81, 0x03, 0x90, 0x00, 0x02, 0x08,
+    0x01, 0x18, 0x83, 0x00, 0x81, 0x03, 0x00, 0x30, 0x82, 0x01, 0x81, 0x03, 0x8A, 0x00, 0x83, 0x01,
+    0x92, 0x00, 0x82, 0x03, 0x01, 0x0E, 0x06, 0x8F, 0x00, 0x82, 0x03, 0x00, 0x0E, 0x83, 0x00, 0x00,
+    0x08, 0x81, 0x03, 0x00, 0x02, 0x81, 0x00, 0x00, 0x33, 0x82, 0x03, 0x85, 0x00, 0x93, 0x01, 0x83,
+    0x00, 0x8C, 0x03, 0x81, 0x12, 0x07, 0x03, 0x1D, 0x14, 0x08, 0x00, 0x06, 0x00, 0x0A, 0x87, 0x00,
+    0x00, 0x32, 0x85, 0x03, 0x00, 0x21, 0x8E, 0x00, 0x85, 0x03, 0xA7, 0x01, 0x81, 0x03, 0x82, 0x01,
+    0x84, 0x03, 0x82, 0x01, 0x81, 0x03, 0xB0, 0x01, 0x91, 0x00, 0x00, 0x36, 0x89, 0x00, 0x00, 0x02,
+    0x81, 0x03, 0x01, 0x0F, 0x33, 0x81, 0x03, 0x00, 0x02, 0x86, 0x00, 0x07, 0x03, 0x00, 0x03, 0x27,
+    0x3A, 0x01, 0x02, 0x20, 0x8B, 0x00, 0x83, 0x01, 0x90, 0x00, 0x00, 0x01, 0x83, 0x03, 0x00, 0x17,
+    0x90, 0x00, 0x00, 0x0B, 0x82, 0x03, 0x82, 0x00, 0x00, 0x06, 0x82, 0x03, 0x00, 0x1A, 0x82, 0x00,
+    0x82, 0x03, 0x85, 0x00, 0x93, 0x01, 0x82, 0x00, 0x00, 0x17, 0x88, 0x03, 0x81, 0x12, 0x81, 0x03,
+    0x81, 0x1D, 0x02, 0x08, 0x03, 0x14, 0x8D, 0x00, 0x00, 0x08, 0x84, 0x03, 0x00, 0x08, 0x8E, 0x00,
+    0x85, 0x03, 0xA7, 0x01, 0x81, 0x03, 0x82, 0x01, 0x84, 0x03, 0x82, 0x01, 0x81, 0x03, 0xB0, 0x01,
+    0x92, 0x00, 0x01, 0x28, 0x3D, 0x86, 0x00, 0x01, 0x1A, 0x00, 0x85, 0x01, 0x01, 0x3E, 0x14, 0x84,
+    0x00, 0x07, 0x25, 0x02, 0x22, 0x06, 0x03, 0x37, 0x03, 0x14, 0x8C, 0x00, 0x83, 0x01, 0x90, 0x00,
+    0x01, 0x01, 0x08, 0x81, 0x03, 0x01, 0x16, 0x02, 0x91, 0x00, 0x00, 0x08, 0x81, 0x03, 0x00, 0x08,
+    0x82, 0x00, 0x00, 0x2E, 0x81, 0x03, 0x00, 0x0E, 0x82, 0x00, 0x82, 0x03, 0x85, 0x00, 0x93, 0x01,
+    0x82, 0x00, 0x85, 0x03, 0x09, 0x0E, 0x2B, 0x08, 0x03, 0x12, 0x0E, 0x12, 0x03, 0x1D, 0x12, 0x81,
+    0x03, 0x00, 0x06, 0x8E, 0x00, 0x86, 0x03, 0x8C, 0x00, 0x00, 0x06, 0x85, 0x03, 0xA7, 0x01, 0x81,
+    0x03, 0x82, 0x01, 0x84, 0x03, 0x82, 0x01, 0x81, 0x03, 0xB0, 0x01, 0x94, 0x00, 0x07, 0x3C, 0x03,
+    0x18, 0x02, 0x03, 0x30, 0x00, 0x0A, 0x87, 0x01, 0x00, 0x0A, 0x85, 0x00, 0x02, 0x1E, 0x00, 0x2B,
+    0x90, 0x00, 0x83, 0x01, 0x90, 0x00, 0x00, 0x17, 0x82, 0x03, 0x00, 0x01, 0x92, 0x00, 0x00, 0x3F,
+    0x81, 0x03, 0x00, 0x12, 0x82, 0x00, 0x00, 0x17, 0x82, 0x03, 0x82, 0x00, 0x82, 0x03, 0x00, 0x0B,
+    0x84, 0x00, 0x93, 0x01, 0x81, 0x00, 0x00, 0x22, 0x85, 0x03, 0x04, 0x17, 0x00, 0x1D, 0x08, 0x03,
+    0x81, 0x1D, 0x83, 0x03, 0x00, 0x12, 0x8F, 0x00, 0x00, 0x16, 0x85, 0x03, 0x00, 0x15, 0x8B, 0x00,
+    0x00, 0x08, 0x84, 0x03, 0x00, 0x3E, 0x9E, 0x01, 0x00, 0x00, 0x81, 0x0E, 0x01, 0x40, 0x02, 0x83,
+    0x01, 0x81, 0x03, 0x82, 0x01, 0x84, 0x03, 0x82, 0x01, 0x81, 0x03, 0xB0, 0x01, 0x94, 0x00, 0x00,
+    0x15, 0x84, 0x01, 0x00, 0x08, 0x82, 0x01, 0x82, 0x03, 0x00, 0x32, 0x82, 0x01, 0x81, 0x03, 0x04,
+    0x10, 0x06, 0x00, 0x34, 0x24, 0x92, 0x00, 0x83, 0x01, 0x84, 0x00, 0x02, 0x02, 0x06, 0x02, 0x84,
+    0x00, 0x00, 0x02, 0x82, 0x00, 0x00, 0x14, 0x81, 0x03, 0x01, 0x08, 0x06, 0x92, 0x00, 0x00, 0x02,
+    0x82, 0x03, 0x00, 0x02, 0x81, 0x00, 0x00, 0x02, 0x82, 0x03, 0x82, 0x00, 0x82, 0x03, 0x00, 0x33,
+    0x84, 0x00, 0x93, 0x01, 0x81, 0x00, 0x85, 0x03, 0x04, 0x0E, 0x00, 0x18, 0x00, 0x08, 0x86, 0x03,
+    0x00, 0x02, 0x90, 0x00, 0x00, 0x08, 0x85, 0x03, 0x8B, 0x00, 0x85, 0x03, 0x00, 0x00, 0x9E, 0x01,
+    0x83, 0x03, 0x84, 0x01, 0x81, 0x03, 0x82, 0x01, 0x84, 0x03, 0x82, 0x01, 0x81, 0x03, 0xB0, 0x01,
+    0x93, 0x00, 0x00, 0x03, 0x84, 0x01, 0x00, 0x04, 0x81, 0x01, 0x01, 0x03, 0x08, 0x83, 0x01, 0x00,
+    0x03, 0x83, 0x01, 0x01, 0x41, 0x0C, 0x95, 0x00, 0x83, 0x01, 0x83, 0x00, 0x02, 0x02, 0x00, 0x1A,
+    0x83, 0x08, 0x82, 0x0E, 0x82, 0x02, 0x82, 0x03, 0x01, 0x04, 0x02, 0x93, 0x00, 0x82, 0x03, 0x00,
+    0x06, 0x82, 0x00, 0x00, 0x0E, 0x81, 0x03, 0x82, 0x00, 0x82, 0x03, 0x00, 0x42, 0x84, 0x00, 0x93,
+    0x01, 0x01, 0x00, 0x2D, 0x85, 0x03, 0x83, 0x00, 0x86, 0x03, 0x00, 0x2C, 0x91, 0x00, 0x00, 0x06,
+    0x85, 0x03, 0x00, 0x0D, 0x89, 0x00, 0x86, 0x03, 0x00, 0x00, 0x9E, 0x01, 0x00, 0x14, 0x82, 0x03,
+    0x84, 0x01, 0x81, 0x03, 0x82, 0x01, 0x84, 0x03, 0x82, 0x01, 0x81, 0x03, 0xB0, 0x01, 0x83, 0x00,
+    0x00, 0x02, 0x82, 0x03, 0x8B, 0x00, 0x00, 0x03, 0x84, 0x01, 0x00, 0x06, 0x8D, 0x01, 0x00, 0x03,
+    0x95, 0x00, 0x83, 0x01, 0x84, 0x00, 0x00, 0x26, 0x87, 0x03, 0x00, 0x08, 0x81, 0x00, 0x82, 0x03,
+    0x00, 0x20, 0x93, 0x00, 0x01, 0x06, 0x08, 0x81, 0x03, 0x00, 0x2D, 0x81, 0x00, 0x01, 0x02, 0x08,
+    0x81, 0x03, 0x03, 0x02, 0x00, 0x02, 0x08, 0x81, 0x03, 0x00, 0x34, 0x84, 0x00, 0x93, 0x01, 0x00,
+    0x00, 0x85, 0x03, 0x00, 0x21, 0x84, 0x00, 0x85, 0x03, 0x93, 0x00, 0x00, 0x0D, 0x85, 0x03, 0x88,
+    0x00, 0x00, 0x12, 0x85, 0x03, 0x01, 0x2D, 0x00, 0x9F, 0x01, 0x03, 0x30, 0x2C, 0x01, 0x02, 0x83,
+    0x01, 0x81, 0x03, 0x82, 0x01, 0x84, 0x03, 0x82, 0x01, 0x81, 0x03, 0xB0, 0x01, 0x83, 0x00, 0x00,
+    0x03, 0x82, 0x01, 0x01, 0x03, 0x2B, 0x88, 0x00, 0x01, 0x12, 0x03, 0x93, 0x01, 0x05, 0x0E, 0x03,
+    0x3C, 0x01, 0x18, 0x14, 0x90, 0x00, 0x83, 0x01, 0x84, 0x00, 0x01, 0x16, 0x08, 0x87, 0x03, 0x01,
+    0x06, 0x00, 0x82, 0x03, 0x00, 0x32, 0x94, 0x00, 0x82, 0x03, 0x00, 0x18, 0x82, 0x00, 0x02, 0x12,
+    0x14, 0x12, 0x83, 0x00, 0x02, 0x03, 0x08, 0x06, 0x84, 0x00, 0x93, 0x01, 0x00, 0x00, 0x85, 0x03,
+    0x85, 0x00, 0x85, 0x03, 0x00, 0x04, 0x93, 0x00, 0x85, 0x03, 0x00, 0x1A, 0x86, 0x00, 0x00, 0x08,
+    0x86, 0x03, 0x81, 0x00, 0xA0, 0x01, 0x01, 0x02, 0x06, 0x84, 0x01, 0x81, 0x03, 0x82, 0x01, 0x84,
+    0x03, 0x82, 0x01, 0x81, 0x03, 0x82, 0x01, 0x00, 0x02, 0xAC, 0x01, 0x82, 0x00, 0x00, 0x1C, 0x85,
+    0x01, 0x00, 0x0F, 0x86, 0x00, 0x00, 0x03, 0x9B, 0x01, 0x01, 0x00, 0x06, 0x89, 0x00, 0x01, 0x36,
+    0x3C, 0x82, 0x00, 0x83, 0x01, 0x85, 0x00, 0x01, 0x20, 0x0E, 0x82, 0x08, 0x82, 0x03, 0x81, 0x02,
+    0x00, 0x06, 0x82, 0x03, 0x00, 0x1D, 0x93, 0x00, 0x01, 0x0A, 0x08, 0x81, 0x03, 0x00, 0x06, 0x82,
+    0x00, 0x81, 0x01, 0x01, 0x00, 0x02, 0x81, 0x00, 0x02, 0x02, 0x00, 0x06, 0x85, 0x00, 0x93, 0x01,
+    0x00, 0x42, 0x84, 0x03, 0x00, 0x2E, 0x86, 0x00, 0x85, 0x03, 0x93, 0x00, 0x00, 0x30, 0x85, 0x03,
+    0x00, 0x02, 0x83, 0x00, 0x00, 0x25, 0x86, 0x03, 0x00, 0x08, 0x82, 0x00, 0xA1, 0x01, 0x01, 0x00,
+    0x06, 0x83, 0x01, 0x81, 0x03, 0x82, 0x01, 0x84, 0x03, 0x82, 0x01, 0x81, 0x03, 0xB0, 0x01, 0x81,
+    0x00, 0x00, 0x03, 0x85, 0x01, 0x01, 0x43, 0x03, 0x85, 0x00, 0x01, 0x25, 0x29, 0x9C, 0x01, 0x00,
+    0x14, 0x87, 0x00, 0x00, 0x44, 0x82, 0x01, 0x00, 0x03, 0x81, 0x00, 0x83, 0x01, 0x86, 0x00, 0x00,
+    0x06, 0x87, 0x00, 0x01, 0x06, 0x1C, 0x82, 0x03, 0x93, 0x00, 0x00, 0x0A, 0x82, 0x03, 0x92, 0x00,
+    0x93, 0x01, 0x85, 0x03, 0x87, 0x00, 0x85, 0x03, 0x94, 0x00, 0x85, 0x03, 0x04, 0x21, 0x0A, 0x33,
+    0x03, 0x08, 0x87, 0x03, 0x00, 0x26, 0x82, 0x00, 0x9F, 0x01, 0x01, 0x18, 0x02, 0x85, 0x01, 0x81,
+    0x03, 0x82, 0x01, 0x84, 0x03, 0x82, 0x01, 0x05, 0x03, 0x08, 0x01, 0x02, 0x01, 0x0A, 0xAC, 0x01,
+    0x81, 0x00, 0x00, 0x0E, 0x86, 0x01, 0x00, 0x2F, 0x84, 0x00, 0x00, 0x45, 0x9E, 0x01, 0x00, 0x1A,
+    0x85, 0x00, 0x01, 0x02, 0x2D, 0x85, 0x01, 0x00, 0x1D, 0x83, 0x01, 0x90, 0x00, 0x00, 0x17, 0x82,
+    0x03, 0x00, 0x06, 0x92, 0x00, 0x00, 0x10, 0x82, 0x03, 0x92, 0x00, 0x93, 0x01, 0x85, 0x03, 0x87,
+    0x00, 0x00, 0x23, 0x84, 0x03, 0x94, 0x00, 0x00, 0x06, 0x90, 0x03, 0x00, 0x1B, 0x83, 0x00, 0x9D,
+    0x01, 0x01, 0x02, 0x12, 0x82, 0x03, 0x84, 0x01, 0x81, 0x03, 0x82, 0x01, 0x84, 0x03, 0x82, 0x01,
+    0x81, 0x03, 0x02, 0x06, 0x02, 0x06, 0xAD, 0x01, 0x82, 0x00, 0x00, 0x11, 0x84, 0x01, 0x07, 0x2F,
+    0x2E, 0x06, 0x2C, 0x2E, 0x00, 0x03, 0x30, 0x82, 0x01, 0x00, 0x03, 0x82, 0x01, 0x00, 0x06, 0x96,
+    0x01, 0x00, 0x03, 0x82, 0x00, 0x04, 0x02, 0x0A, 0x00, 0x17, 0x3C, 0x8A, 0x01, 0x91, 0x00, 0x00,
+    0x08, 0x81, 0x03, 0x00, 0x36, 0x92, 0x00, 0x00, 0x0E, 0x81, 0x03, 0x00, 0x0E, 0x92, 0x00, 0x93,
+    0x01, 0x85, 0x03, 0x87, 0x00, 0x00, 0x28, 0x84, 0x03, 0x95, 0x00, 0x8F, 0x03, 0x00, 0x05, 0x84,
+    0x00, 0x9C, 0x01, 0x01, 0x00, 0x01, 0x81, 0x14, 0x81, 0x03, 0x84, 0x01, 0x81, 0x03, 0x82, 0x01,
+    0x84, 0x03, 0x82, 0x01, 0x03, 0x0E, 0x14, 0x01, 0x02, 0xAE, 0x01, 0x81, 0x00, 0x01, 0x14, 0x30,
+    0x85, 0x01, 0x02, 0x30, 0x2A, 0x06, 0x81, 0x00, 0x01, 0x08, 0x30, 0x81, 0x3C, 0x00, 0x41, 0x81,
+    0x01, 0x01, 0x02, 0x00, 0x97, 0x01, 0x09, 0x12, 0x02, 0x00, 0x02, 0x37, 0x17, 0x00, 0x02, 0x30,
+    0x2D, 0x84, 0x01, 0x00, 0x2C, 0x83, 0x01, 0x90, 0x00, 0x01, 0x01, 0x14, 0x82, 0x03, 0x00, 0x06,
+    0x90, 0x00, 0x00, 0x11, 0x82, 0x03, 0x00, 0x17, 0x92, 0x00, 0x93, 0x01, 0x85, 0x03, 0x87, 0x00,
+    0x00, 0x08, 0x84, 0x03, 0x91, 0x00, 0x00, 0x06, 0x82, 0x00, 0x00, 0x2A, 0x8C, 0x03, 0x01, 0x08,
+    0x30, 0x85, 0x00, 0x9C, 0x01, 0x02, 0x02, 0x01, 0x44, 0x82, 0x03, 0x84, 0x01, 0x81, 0x03, 0x82,
+    0x01, 0x84, 0x03, 0x82, 0x01, 0x01, 0x0E, 0x12, 0xB0, 0x01, 0x81, 0x00, 0x00, 0x1D, 0x81, 0x30,
+    0x83, 0x01, 0x06, 0x3C, 0x30, 0x00, 0x02, 0x06, 0x00, 0x03, 0x82, 0x30, 0x01, 0x46, 0x03, 0x96,
+    0x01, 0x06, 0x06, 0x01, 0x00, 0x02, 0x01, 0x00, 0x0A, 0x81, 0x00, 0x04, 0x36, 0x08, 0x03, 0x0E,
+    0x3A, 0x83, 0x01, 0x00, 0x28, 0x84, 0x01, 0x90, 0x00, 0x02, 0x02, 0x06, 0x08, 0x81, 0x03, 0x00,
+    0x0E, 0x8F, 0x00, 0x01, 0x0A, 0x1D, 0x81, 0x03, 0x00, 0x12, 0x93, 0x00, 0x93, 0x01, 0x85, 0x03,
+    0x00, 0x37, 0x86, 0x00, 0x00, 0x08, 0x84, 0x03, 0x90, 0x00, 0x00, 0x15, 0x81, 0x03, 0x82, 0x00,
+    0x8B, 0x03, 0x00, 0x14, 0x87, 0x00, 0x9D, 0x01, 0x00, 0x00, 0x86, 0x01, 0x00, 0x02, 0x82, 0x03,
+    0x82, 0x01, 0x84, 0x03, 0x82, 0x01, 0x02, 0x08, 0x04, 0x14, 0xAF, 0x01, 0x82, 0x00, 0x00, 0x22,
+    0x81, 0x30, 0x01, 0x18, 0x02, 0x81, 0x30, 0x00, 0x1D, 0x83, 0x00, 0x00, 0x1D, 0x82, 0x30, 0x00,
+    0x43, 0x9C, 0x01, 0x08, 0x08, 0x00, 0x27, 0x11, 0x0C, 0x18, 0x06, 0x08, 0x2F, 0x89, 0x01, 0x92,
+    0x00, 0x00, 0x1A, 0x82, 0x03, 0x01, 0x05, 0x06, 0x8D, 0x00, 0x00, 0x0E, 0x81, 0x03, 0x01, 0x14,
+    0x0A, 0x93, 0x00, 0x93, 0x01, 0x00, 0x0F, 0x85, 0x03, 0x01, 0x26, 0x02, 0x83, 0x00, 0x00, 0x08,
+    0x85, 0x03, 0x90, 0x00, 0x00, 0x24, 0x81, 0x03, 0x00, 0x3F, 0x81, 0x00, 0x89, 0x03, 0x00, 0x2F,
+    0x89, 0x00, 0xA5, 0x01, 0x00, 0x0E, 0x81, 0x03, 0x00, 0x37, 0x82, 0x01, 0x84, 0x03, 0x82, 0x01,
+    0x00, 0x04, 0x81, 0x03, 0x00, 0x14, 0xAE, 0x01, 0x83, 0x00, 0x06, 0x2C, 0x3C, 0x30, 0x0C, 0x1D,
+    0x06, 0x17, 0x83, 0x00, 0x00, 0x18, 0x83, 0x30, 0x8F, 0x01, 0x01, 0x02, 0x00, 0x81, 0x06, 0x01,
+    0x02, 0x00, 0x86, 0x01, 0x00, 0x03, 0x84, 0x00, 0x00, 0x02, 0x81, 0x03, 0x00, 0x30, 0x88, 0x01,
+    0x92, 0x00, 0x01, 0x06, 0x08, 0x82, 0x03, 0x02, 0x0E, 0x00, 0x02, 0x89, 0x00, 0x01, 0x06, 0x08,
+    0x82, 0x03, 0x00, 0x26, 0x94, 0x00, 0x93, 0x01, 0x00, 0x00, 0x87, 0x03, 0x01, 0x12, 0x07, 0x87,
+    0x03, 0x00, 0x06, 0x91, 0x00, 0x82, 0x03, 0x81, 0x00, 0x00, 0x32, 0x84, 0x03, 0x00, 0x29, 0x8D,
+    0x00, 0xA4, 0x01, 0x82, 0x03, 0x00, 0x0F, 0x82, 0x01, 0x00, 0x16, 0x84, 0x03, 0x00, 0x30, 0x82,
+    0x01, 0x03, 0x07, 0x03, 0x08, 0x31, 0xAD, 0x01, 0x83, 0x00, 0x04, 0x17, 0x18, 0x03, 0x14, 0x02,
+    0x86, 0x00, 0x00, 0x03, 0x84, 0x30, 0x81, 0x02, 0x8B, 0x01, 0x00, 0x06, 0x88, 0x01, 0x02, 0x30,
+    0x01, 0x02, 0x87, 0x00, 0x85, 0x30, 0x00, 0x03, 0x83, 0x01, 0x92, 0x00, 0x02, 0x02, 0x00, 0x0E,
+    0x82, 0x03, 0x02, 0x0E, 0x30, 0x02, 0x87, 0x00, 0x01, 0x40, 0x12, 0x82, 0x03, 0x00, 0x12, 0x95,
+    0x00, 0x93, 0x01, 0x01, 0x00, 0x24, 0x90, 0x03, 0x92, 0x00, 0x82, 0x03, 0x81, 0x00, 0x00, 0x2D,
+    0x84, 0x03, 0x00, 0x25, 0x8D, 0x00, 0xA3, 0x01, 0x00, 0x02, 0x81, 0x03, 0x00, 0x21, 0x81, 0x01,
+    0x00, 0x02, 0x88, 0x03, 0x03, 0x02, 0x01, 0x02, 0x08, 0x81, 0x03, 0x00, 0x02, 0xAC, 0x01, 0x84,
+    0x00, 0x00, 0x06, 0x8A, 0x00, 0x02, 0x0F, 0x21, 0x08, 0x83, 0x30, 0x8E, 0x01, 0x00, 0x00, 0x86,
+    0x30, 0x01, 0x2C, 0x03, 0x87, 0x00, 0x06, 0x1D, 0x1F, 0x22, 0x08, 0x2E, 0x0E, 0x00, 0x83, 0x01,
+    0x92, 0x00, 0x03, 0x01, 0x06, 0x02, 0x0E, 0x84, 0x03, 0x07, 0x04, 0x30, 0x02, 0x00, 0x02, 0x3E,
+    0x03, 0x08, 0x83, 0x03, 0x04, 0x1A, 0x06, 0x02, 0x00, 0x02, 0x84, 0x00, 0x81, 0x02, 0x8B, 0x00,
+    0x93, 0x01, 0x81, 0x00, 0x8E, 0x03, 0x00, 0x08, 0x93, 0x00, 0x82, 0x03, 0x81, 0x00, 0x00, 0x18,
+    0x84, 0x03, 0x00, 0x15, 0x8D, 0x00, 0xA3, 0x01, 0x82, 0x03, 0x00, 0x02, 0x81, 0x01, 0x8A, 0x03,
+    0x82, 0x01, 0x81, 0x03, 0x00, 0x08, 0xAC, 0x01, 0x92, 0x00, 0x01, 0x47, 0x04, 0x82, 0x30, 0x00,
+    0x18, 0x81, 0x01, 0x00, 0x00, 0x85, 0x01, 0x00, 0x30, 0x82, 0x01, 0x00, 0x47, 0x86, 0x30, 0x01,
+    0x15, 0x02, 0x8F, 0x00, 0x83, 0x01, 0x8F, 0x00, 0x00, 0x01, 0x81, 0x03, 0x00, 0x12, 0x81, 0x02,
+    0x03, 0x00, 0x08, 0x14, 0x08, 0x8B, 0x03, 0x01, 0x0E, 0x2D, 0x81, 0x00, 0x03, 0x0E, 0x03, 0x08,
+    0x0A, 0x82, 0x00, 0x81, 0x0A, 0x00, 0x02, 0x8B, 0x00, 0x93, 0x01, 0x82, 0x00, 0x8C, 0x03, 0x00,
+    0x08, 0x94, 0x00, 0x82, 0x03, 0x81, 0x00, 0x00, 0x2A, 0x84, 0x03, 0x00, 0x06, 0x8D, 0x00, 0xA3,
+    0x01, 0x81, 0x03, 0x00, 0x30, 0x81, 0x01, 0x00, 0x0E, 0x81, 0x03, 0x01, 0x0E, 0x05, 0x87, 0x03,
+    0x81, 0x01, 0x00, 0x07, 0x81, 0x03, 0xAC, 0x01, 0x8D, 0x00, 0x01, 0x03, 0x06, 0x81, 0x00, 0x00,
+    0x03, 0x88, 0x30, 0x83, 0x01, 0x87, 0x30, 0x00, 0x48, 0x81, 0x30, 0x03, 0x01, 0x15, 0x30, 0x03,
+    0x84, 0x00, 0x01, 0x01, 0x0E, 0x89, 0x00, 0x83, 0x01, 0x8F, 0x00, 0x00, 0x0E, 0x81, 0x03, 0x06,
+    0x0E, 0x00, 0x02, 0x00, 0x17, 0x00, 0x0E, 0x89, 0x03, 0x02, 0x0E, 0x1A, 0x06, 0x81, 0x00, 0x00,
+    0x02, 0x82, 0x03, 0x01, 0x08, 0x0A, 0x81, 0x02, 0x81, 0x0A, 0x00, 0x02, 0x8B, 0x00, 0x93, 0x01,
+    0x83, 0x00, 0x00, 0x40, 0x8A, 0x03, 0x94, 0x00, 0x00, 0x2F, 0x81, 0x03, 0x00, 0x3D, 0x81, 0x00,
+    0x00, 0x12, 0x84, 0x03, 0x8E, 0x00, 0xA2, 0x01, 0x00, 0x15, 0x81, 0x03, 0x03, 0x02, 0x01, 0x2C,
+    0x0E, 0x81, 0x03, 0x81, 0x01, 0x00, 0x08, 0x86, 0x03, 0x82, 0x01, 0x81, 0x03, 0x00, 0x02, 0xAB,
+    0x01, 0x8C, 0x00, 0x81, 0x01, 0x00, 0x04, 0x81, 0x00, 0x00, 0x34, 0x83, 0x30, 0x00, 0x06, 0x8F,
+    0x30, 0x00, 0x08, 0x81, 0x30, 0x01, 0x01, 0x30, 0x85, 0x00, 0x81, 0x01, 0x00, 0x03, 0x89, 0x00,
+    0x83, 0x01, 0x8E, 0x00, 0x00, 0x08, 0x82, 0x03, 0x05, 0x08, 0x01, 0x02, 0x17, 0x0A, 0x06, 0x81,
+    0x00, 0x01, 0x41, 0x03, 0x81, 0x08, 0x81, 0x03, 0x03, 0x0E, 0x14, 0x18, 0x06, 0x84, 0x00, 0x00,
+    0x0E, 0x82, 0x03, 0x03, 0x14, 0x02, 0x06, 0x17, 0x8D, 0x00, 0x93, 0x01, 0x85, 0x00, 0x00, 0x0E,
+    0x87, 0x03, 0x95, 0x00, 0x82, 0x03, 0x82, 0x00, 0x85, 0x03, 0x8E, 0x00, 0xA2, 0x01, 0x00, 0x08,
+    0x81, 0x03, 0x81, 0x01, 0x00, 0x08, 0x81, 0x03, 0x81, 0x01, 0x00, 0x1D, 0x87, 0x03, 0x00, 0x0E,
+    0x81, 0x01, 0x81, 0x03, 0x00, 0x3E, 0xAB, 0x01, 0x8C, 0x00, 0x82, 0x01, 0x82, 0x00, 0x00, 0x04,
+    0x83, 0x30, 0x00, 0x01, 0x82, 0x30, 0x00, 0x43, 0x81, 0x30, 0x00, 0x29, 0x84, 0x30, 0x05, 0x08,
+    0x30, 0x36, 0x30, 0x0A, 0x01, 0x81, 0x30, 0x86, 0x00, 0x01, 0x01, 0x34, 0x89, 0x00, 0x83, 0x01,
+    0x8C, 0x00, 0x00, 0x06, 0x83, 0x03, 0x05, 0x08, 0x00, 0x0A, 0x02, 0x06, 0x02, 0x82, 0x00, 0x00,
+    0x02, 0x83, 0x00, 0x01, 0x02, 0x00, 0x81, 0x06, 0x00, 0x02, 0x84, 0x00, 0x07, 0x02, 0x1D, 0x08,
+    0x1C, 0x1A, 0x0E, 0x00, 0x02, 0x8D, 0x00, 0x93, 0x01, 0x87, 0x00, 0x00, 0x02, 0x85, 0x03, 0x94,
+    0x00, 0x00, 0x29, 0x82, 0x03, 0x82, 0x00, 0x85, 0x03, 0x8E, 0x00, 0xA2, 0x01, 0x81, 0x03, 0x00,
+    0x08, 0x81, 0x01, 0x81, 0x03, 0x00, 0x08, 0x81, 0x01, 0x89, 0x03, 0x81, 0x01, 0x82, 0x03, 0xAB,
+    0x01, 0x8D, 0x00, 0x00, 0x0A, 0x84, 0x00, 0x81, 0x03, 0x00, 0x08, 0x81, 0x30, 0x00, 0x0A, 0x82,
+    0x30, 0x81, 0x03, 0x01, 0x08, 0x3A, 0x82, 0x30, 0x00, 0x08, 0x86, 0x30, 0x00, 0x03, 0x92, 0x00,
+    0x83, 0x01, 0x8B, 0x00, 0x01, 0x17, 0x08, 0x82, 0x03, 0x00, 0x14, 0x81, 0x06, 0x00, 0x0A, 0x81,
+    0x06, 0x00, 0x02, 0x84, 0x00, 0x00, 0x02, 0x8C, 0x00, 0x06, 0x0A, 0x14, 0x0E, 0x2E, 0x12, 0x0E,
+    0x0A, 0x8D, 0x00, 0x93, 0x01, 0x88, 0x00, 0x00, 0x16, 0x85, 0x03, 0x93, 0x00, 0x00, 0x08, 0x81,
+    0x03, 0x82, 0x00, 0x00, 0x33, 0x85, 0x03, 0x8E, 0x00, 0xA2, 0x01, 0x81, 0x03, 0x00, 0x12, 0x81,
+    0x01, 0x82, 0x03, 0x81, 0x01, 0x89, 0x03, 0x81, 0x01, 0x00, 0x0E, 0x81, 0x03, 0xAB, 0x01, 0x96,
+    0x00, 0x00, 0x3C, 0x86, 0x30, 0x01, 0x2C, 0x21, 0x82, 0x03, 0x02, 0x30, 0x03, 0x27, 0x83, 0x30,
+    0x02, 0x03, 0x3F, 0x3E, 0x91, 0x00, 0x83, 0x01, 0x8B, 0x00, 0x01, 0x43, 0x08, 0x81, 0x03, 0x03,
+    0x0E, 0x02, 0x00, 0x02, 0x81, 0x06, 0x87, 0x00, 0x81, 0x12, 0x8A, 0x00, 0x03, 0x02, 0x01, 0x1D,
+    0x08, 0x81, 0x03, 0x01, 0x08, 0x02, 0x8C, 0x00, 0x93, 0x01, 0x89, 0x00, 0x85, 0x03, 0x92, 0x00,
+    0x82, 0x03, 0x00, 0x08, 0x82, 0x00, 0x85, 0x03, 0x8F, 0x00, 0xA2, 0x01, 0x82, 0x03, 0x81, 0x01,
+    0x82, 0x03, 0x01, 0x01, 0x02, 0x89, 0x03, 0x81, 0x01, 0x81, 0x03, 0x00, 0x0E, 0xAB, 0x01, 0x96,
+    0x00, 0x01, 0x44, 0x47, 0x8A, 0x30, 0x00, 0x03, 0x81, 0x00, 0x83, 0x03, 0x81, 0x00, 0x01, 0x3C,
+    0x1E, 0x90, 0x00, 0x83, 0x01, 0x8B, 0x00, 0x00, 0x2A, 0x81, 0x03, 0x01, 0x14, 0x06, 0x8B, 0x00,
+    0x00, 0x08, 0x81, 0x03, 0x01, 0x14, 0x06, 0x89, 0x00, 0x02, 0x02, 0x00, 0x1D, 0x81, 0x03, 0x00,
+    0x08, 0x8D, 0x00, 0x93, 0x01, 0x89, 0x00, 0x86, 0x03, 0x91, 0x00, 0x81, 0x03, 0x00, 0x08, 0x82,
+    0x00, 0x00, 0x20, 0x85, 0x03, 0x8F, 0x00, 0xA2, 0x01, 0x00, 0x14, 0x81, 0x03, 0x81, 0x01, 0x82,
+    0x03, 0x00, 0x08, 0x89, 0x03, 0x00, 0x1D, 0x81, 0x01, 0x81, 0x03, 0x00, 0x2B, 0xAB, 0x01, 0x92,
+    0x00, 0x00, 0x06, 0x83, 0x00, 0x01, 0x32, 0x03, 0x83, 0x30, 0x00, 0x03, 0x83, 0x30, 0x01, 0x03,
+    0x2D, 0x88, 0x00, 0x06, 0x08, 0x25, 0x02, 0x30, 0x01, 0x03, 0x31, 0x8A, 0x00, 0x83, 0x01, 0x8B,
+    0x00, 0x02, 0x02, 0x3D, 0x23, 0x8D, 0x00, 0x82, 0x03, 0x00, 0x08, 0x8C, 0x00, 0x03, 0x01, 0x27,
+    0x08, 0x02, 0x8D, 0x00, 0x93, 0x01, 0x89, 0x00, 0x00, 0x0A, 0x85, 0x03, 0x00, 0x3C, 0x8A, 0x00,
+    0x03, 0x17, 0x33, 0x08, 0x03, 0x82, 0x00, 0x00, 0x11, 0x82, 0x00, 0x00, 0x06, 0x85, 0x03, 0x00,
+    0x23, 0x8F, 0x00, 0xA2, 0x01, 0x00, 0x0A, 0x81, 0x03, 0x00, 0x00, 0x81, 0x01, 0x8C, 0x03, 0x82,
+    0x01, 0x81, 0x03, 0xAC, 0x01, 0x91, 0x00, 0x03, 0x03, 0x02, 0x00, 0x18, 0x84, 0x00, 0x00, 0x1F,
+    0x82, 0x00, 0x00, 0x02, 0x82, 0x03, 0x8A, 0x00, 0x00, 0x18, 0x84, 0x01, 0x01, 0x02, 0x40, 0x89,
+    0x00, 0x83, 0x01, 0x9C, 0x00, 0x82, 0x03, 0x00, 0x08, 0x9E, 0x00, 0x93, 0x01, 0x8A, 0x00, 0x86,
+    0x03, 0x88, 0x00, 0x01, 0x02, 0x08, 0x83, 0x03, 0x00, 0x0F, 0x85, 0x00, 0x86, 0x03, 0x90, 0x00,
+    0xA3, 0x01, 0x81, 0x03, 0x00, 0x28, 0x81, 0x01, 0x8C, 0x03, 0x81, 0x01, 0x00, 0x0E, 0x81, 0x03,
+    0xAC, 0x01, 0x8B, 0x00, 0x00, 0x08, 0x81, 0x01, 0x04, 0x06, 0x01, 0x08, 0x00, 0x06, 0x99, 0x00,
+    0x00, 0x02, 0x86, 0x01, 0x00, 0x08, 0x88, 0x00, 0x83, 0x01, 0x9C, 0x00, 0x00, 0x08, 0x81, 0x03,
+    0x00, 0x08, 0x9E, 0x00, 0x93, 0x01, 0x8B, 0x00, 0x86, 0x03, 0x88, 0x00, 0x84, 0x03, 0x00, 0x02,
+    0x84, 0x00, 0x00, 0x08, 0x85, 0x03, 0x00, 0x1F, 0x90, 0x00, 0xA3, 0x01, 0x03, 0x08, 0x03, 0x08,
+    0x02, 0x81, 0x01, 0x8A, 0x03, 0x81, 0x01, 0x00, 0x02, 0x81, 0x03, 0x01, 0x31, 0x02, 0xAB, 0x01,
+    0x8A, 0x00, 0x00, 0x2B, 0x85, 0x01, 0x02, 0x0D, 0x02, 0x1D, 0x8A, 0x00, 0x01, 0x30, 0x13, 0x8B,
+    0x00, 0x01, 0x02, 0x03, 0x85, 0x01, 0x00, 0x34, 0x88, 0x00, 0x83, 0x01, 0x9C, 0x00, 0x82, 0x03,
+    0x00, 0x0E, 0x9E, 0x00, 0x93, 0x01, 0x8B, 0x00, 0x00, 0x1D, 0x86, 0x03, 0x00, 0x0C, 0x86, 0x00,
+    0x02, 0x0C, 0x27, 0x2B, 0x86, 0x00, 0x86, 0x03, 0x00, 0x08, 0x91, 0x00, 0xA3, 0x01, 0x00, 0x02,
+    0x82, 0x03, 0x00, 0x00, 0x81, 0x01, 0x88, 0x03, 0x82, 0x01, 0x03, 0x08, 0x03, 0x0E, 0x00, 0xAC,
+    0x01, 0x8A, 0x00, 0x00, 0x03, 0x85, 0x01, 0x81, 0x03, 0x8B, 0x00, 0x01, 0x43, 0x04, 0x8B, 0x00,
+    0x00, 0x32, 0x86, 0x01, 0x00, 0x0E, 0x88, 0x00, 0x83, 0x01, 0x9C, 0x00, 0x00, 0x0E, 0x81, 0x03,
+    0x00, 0x14, 0x9E, 0x00, 0x93, 0x01, 0x8C, 0x00, 0x87, 0x03, 0x00, 0x08, 0x8D, 0x00, 0x00, 0x21,
+    0x86, 0x03, 0x00, 0x08, 0x92, 0x00, 0xA4, 0x01, 0x00, 0x10, 0x81, 0x03, 0x00, 0x1D, 0x82, 0x01,
+    0x00, 0x02, 0x81, 0x08, 0x81, 0x03, 0x00, 0x0E, 0x82, 0x01, 0x00, 0x00, 0x81, 0x03, 0x01, 0x08,
+    0x00, 0xAD, 0x01, 0x8A, 0x00, 0x87, 0x01, 0x00, 0x0E, 0x8B, 0x00, 0x01, 0x1C, 0x03, 0x8A, 0x00,
+    0x00, 0x0D, 0x87, 0x01, 0x00, 0x16, 0x88, 0x00, 0x83, 0x01, 0x9C, 0x00, 0x00, 0x08, 0x81, 0x03,
+    0x00, 0x0E, 0x9E, 0x00, 0x93, 0x01, 0x8D, 0x00, 0x89, 0x03, 0x89, 0x00, 0x01, 0x1C, 0x08, 0x86,
+    0x03, 0x00, 0x08, 0x93, 0x00, 0xA5, 0x01, 0x83, 0x03, 0x89, 0x01, 0x01, 0x02, 0x08, 0x81, 0x03,
+    0x00, 0x12, 0xAE, 0x01, 0x8A, 0x00, 0x81, 0x01, 0x00, 0x30, 0x85, 0x01, 0x8B, 0x00, 0x01, 0x08,
+    0x03, 0x8A, 0x00, 0x02, 0x0A, 0x2D, 0x30, 0x82, 0x01, 0x00, 0x0A, 0x81, 0x30, 0x00, 0x03, 0x88,
+    0x00, 0x83, 0x01, 0x9C, 0x00, 0x82, 0x03, 0x01, 0x1D, 0x02, 0x9D, 0x00, 0x93, 0x01, 0x8E, 0x00,
+    0x8C, 0x03, 0x02, 0x05, 0x44, 0x0E, 0x8A, 0x03, 0x00, 0x08, 0x94, 0x00, 0xA6, 0x01, 0x00, 0x08,
+    0x81, 0x03, 0x01, 0x0E, 0x07, 0x86, 0x01, 0x81, 0x08, 0x81, 0x03, 0x00, 0x1B, 0x81, 0x01, 0x00,
+    0x06, 0xAC, 0x01, 0x8A, 0x00, 0x02, 0x30, 0x01, 0x30, 0x85, 0x01, 0x8B, 0x00, 0x81, 0x03, 0x8B,
+    0x00, 0x03, 0x03, 0x30, 0x18, 0x00, 0x82, 0x30, 0x00, 0x1D, 0x89, 0x00, 0x83, 0x01, 0x9D, 0x00,
+    0x02, 0x03, 0x08, 0x02, 0x9E, 0x00, 0x93, 0x01, 0x8E, 0x00, 0x00, 0x02, 0x99, 0x03, 0x00, 0x02,
+    0x94, 0x00, 0xA0, 0x01, 0x01, 0x02, 0x06, 0x84, 0x01, 0x00, 0x26, 0x85, 0x03, 0x82, 0x08, 0x83,
+    0x03, 0x00, 0x2D, 0x81, 0x01, 0x81, 0x06, 0x00, 0x0A, 0xAB, 0x01, 0x8A, 0x00, 0x04, 0x06, 0x08,
+    0x2C, 0x1D, 0x30, 0x82, 0x01, 0x00, 0x03, 0x89, 0x00, 0x01, 0x14, 0x01, 0x81, 0x02, 0x00, 0x42,
+    0x8A, 0x00, 0x01, 0x32, 0x2D, 0x81, 0x30, 0x00, 0x03, 0x81, 0x30, 0x8A, 0x00, 0x83, 0x01, 0x9D,
+    0x00, 0x00, 0x02, 0xA0, 0x00, 0x93, 0x01, 0x90, 0x00, 0x00, 0x1C, 0x96, 0x03, 0x00, 0x02, 0x95,
+    0x00, 0xA0, 0x01, 0x00, 0x06, 0x86, 0x01, 0x00, 0x00, 0x89, 0x03, 0x00, 0x1A, 0x82, 0x01, 0x82,
+    0x00, 0xAC, 0x01, 0x8B, 0x00, 0x04, 0x03, 0x30, 0x2C, 0x13, 0x30, 0x81, 0x03, 0x8A, 0x00, 0x00,
+    0x03, 0x83, 0x01, 0x00, 0x02, 0x8B, 0x00, 0x01, 0x1B, 0x40, 0x81, 0x00, 0x00, 0x02, 0x8A, 0x00,
+    0x83, 0x01, 0xBF, 0x00, 0x93, 0x01, 0x92, 0x00, 0x92, 0x03, 0x01, 0x08, 0x18, 0x97, 0x00, 0x9E,
+    0x01, 0x00, 0x00, 0x8C, 0x01, 0x04, 0x27, 0x0E, 0x03, 0x0E, 0x33, 0x84, 0x01, 0x82, 0x00, 0xAD,
+    0x01, 0x8C, 0x00, 0x00, 0x03, 0x81, 0x30, 0x01, 0x2C, 0x2D, 0x8B, 0x00, 0x01, 0x02, 0x03, 0x82,
+    0x01, 0x9C, 0x00, 0x83, 0x01, 0xBF, 0x00, 0x93, 0x01, 0x94, 0x00, 0x8F, 0x03, 0x01, 0x0B, 0x02,
+    0x98, 0x00, 0x9E, 0x01, 0x01, 0x00, 0x06, 0x95, 0x01, 0x02, 0x02, 0x06, 0x02, 0xAD, 0x01, 0x97,
+    0x00, 0x01, 0x0A, 0x02, 0x9B, 0x00, 0x01, 0x02, 0x17, 0x87, 0x00, 0x83, 0x01, 0xBF, 0x00, 0x93,
+    0x01, 0x96, 0x00, 0x00, 0x1E, 0x81, 0x08, 0x87, 0x03, 0x00, 0x28, 0x9C, 0x00, 0x9C, 0x01, 0x01,
+    0x06, 0x02, 0x95, 0x01, 0x81, 0x00, 0x01, 0x01, 0x02, 0xAE, 0x01, 0x94, 0x00, 0x00, 0x0A, 0x9D,
+    0x00, 0x04, 0x06, 0x17, 0x00, 0x17, 0x0A, 0x86, 0x00, 0x83, 0x01, 0xBF, 0x00, 0x93, 0x01, 0xBF,
+    0x00, 0x9C, 0x01, 0x81, 0x06, 0x95, 0x01, 0x02, 0x02, 0x01, 0x02, 0xAF, 0x01, 0x8E, 0x00, 0x01,
+    0x02, 0x0A, 0x81, 0x06, 0x9A, 0x00, 0x02, 0x02, 0x00, 0x17, 0x8E, 0x00, 0xFF, 0x01, 0xFF, 0x01,
+    0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01,
+    0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01,
+    0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01,
+    0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01,
+    0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01,
+    0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01,
+    0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01,
+    0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01,
+    0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01,
+    0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01,
+    0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01,
+    0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01,
+    0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01,
+    0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01,
+    0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01,
+    0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01,
+    0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01,
+    0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01,
+    0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01,
+    0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01,
+    0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01,
+    0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01,
+    0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01,
+    0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01,
+    0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01,
+    0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0x85, 0x01, 0x00, 0x49, 0x89, 0x4A, 0x00, 0x49, 0x88, 0x01,
+    0x02, 0x49, 0x4A, 0x49, 0xFF, 0x01, 0xFF, 0x01, 0xA7, 0x01, 0x04, 0x4A, 0x4B, 0x4C, 0x01, 0x4D,
+    0x81, 0x4A, 0x00, 0x4D, 0x81, 0x01, 0x02, 0x4D, 0x4A, 0x4C, 0x87, 0x01, 0x82, 0x4A, 0xFF, 0x01,
+    0xFF, 0x01, 0xA6, 0x01, 0x02, 0x4D, 0x4E, 0x4C, 0x82, 0x01, 0x81, 0x4A, 0x83, 0x01, 0x81, 0x4F,
+    0x87, 0x01, 0x02, 0x49, 0x4A, 0x49, 0xFF, 0x01, 0xFF, 0x01, 0xA6, 0x01, 0x01, 0x4E, 0x4D, 0x83,
+    0x01, 0x81, 0x4A, 0x83, 0x01, 0x01, 0x4C, 0x4A, 0xFF, 0x01, 0xFF, 0x01, 0xB1, 0x01, 0x00, 0x50,
+    0x84, 0x01, 0x81, 0x4A, 0x84, 0x01, 0x00, 0x50, 0xFF, 0x01, 0xFF, 0x01, 0xB7, 0x01, 0x81, 0x4A,
+    0xFF, 0x01, 0xFF, 0x01, 0xBD, 0x01, 0x81, 0x4A, 0x8D, 0x01, 0x01, 0x4D, 0x50, 0x88, 0x01, 0x01,
+    0x4D, 0x50, 0xFF, 0x01, 0xFF, 0x01, 0xA2, 0x01, 0x81, 0x4A, 0x89, 0x01, 0x00, 0x50, 0x84, 0x4A,
+    0x87, 0x01, 0x00, 0x50, 0x81, 0x4A, 0x09, 0x51, 0x4E, 0x4A, 0x4F, 0x4C, 0x4D, 0x4E, 0x4A, 0x4F,
+    0x52, 0x86, 0x01, 0x01, 0x4D, 0x4E, 0x82, 0x4A, 0x01, 0x4F, 0x52, 0x89, 0x01, 0x00, 0x52, 0x81,
+    0x4F, 0x00, 0x52, 0xFF, 0x01, 0xFC, 0x01, 0x81, 0x4A, 0x8C, 0x01, 0x00, 0x4D, 0x81, 0x4A, 0x87,
+    0x01, 0x00, 0x4D, 0x81, 0x4A, 0x00, 0x4E, 0x81, 0x4D, 0x81, 0x4A, 0x00, 0x4E, 0x81, 0x4D, 0x01,
+    0x4A, 0x4F, 0x84, 0x01, 0x03, 0x52, 0x4F, 0x4E, 0x4D, 0x81, 0x01, 0x00, 0x4C, 0x81, 0x4B, 0x00,
+    0x52, 0x88, 0x01, 0x00, 0x4F, 0x81, 0x4A, 0x00, 0x4F, 0xFF, 0x01, 0xFC, 0x01, 0x81, 0x4A, 0x8D,
+    0x01, 0x81, 0x4A, 0x88, 0x01, 0x81, 0x4A, 0x00, 0x4D, 0x81, 0x01, 0x81, 0x4A, 0x00, 0x4D, 0x81,
+    0x01, 0x81, 0x4A, 0x84, 0x01, 0x02, 0x4F, 0x4B, 0x4C, 0x83, 0x01, 0x02, 0x52, 0x4B, 0x4F, 0x88,
+    0x01, 0x00, 0x4F, 0x81, 0x4A, 0x00, 0x4F, 0xFF, 0x01, 0xFC, 0x01, 0x81, 0x4A, 0x8D, 0x01, 0x81,
+    0x4A, 0x88, 0x01, 0x81, 0x4A, 0x82, 0x01, 0x81, 0x4A, 0x82, 0x01, 0x81, 0x4A, 0x83, 0x01, 0x02,
+    0x4C, 0x4A, 0x4C, 0x85, 0x01, 0x02, 0x4C, 0x4A, 0x4C, 0x87, 0x01, 0x00, 0x52, 0x81, 0x4F, 0x00,
+    0x52, 0xFF, 0x01, 0xFC, 0x01, 0x81, 0x4A, 0x8D, 0x01, 0x81, 0x4A, 0x88, 0x01, 0x81, 0x4A, 0x82,
+    0x01, 0x81, 0x4A, 0x82, 0x01, 0x81, 0x4A, 0x83, 0x01, 0x01, 0x4F, 0x4A, 0x87, 0x01, 0x01, 0x4A,
+    0x4F, 0xFF, 0x01, 0xFF, 0x01, 0x88, 0x01, 0x81, 0x4A, 0x8D, 0x01, 0x81, 0x4A, 0x88, 0x01, 0x81,
+    0x4A, 0x82, 0x01, 0x81, 0x4A, 0x82, 0x01, 0x81, 0x4A, 0x83, 0x01, 0x81, 0x4A, 0x00, 0x4D, 0x85,
+    0x01, 0x00, 0x4D, 0x81, 0x4A, 0xFF, 0x01, 0xFF, 0x01, 0x88, 0x01, 0x81, 0x4A, 0x8D, 0x01, 0x81,
+    0x4A, 0x88, 0x01, 0x81, 0x4A, 0x82, 0x01, 0x81, 0x4A, 0x82, 0x01, 0x81, 0x4A, 0x83, 0x01, 0x8A,
+    0x4A, 0x00, 0x49, 0xFF, 0x01, 0xFF, 0x01, 0x88, 0x01, 0x81, 0x4A, 0x8D, 0x01, 0x81, 0x4A, 0x88,
+    0x01, 0x81, 0x4A, 0x82, 0x01, 0x81, 0x4A, 0x82, 0x01, 0x81, 0x4A, 0x83, 0x01, 0x81, 0x4A, 0x00,
+    0x4D, 0xFF, 0x01, 0xFF, 0x01, 0x91, 0x01, 0x81, 0x4A, 0x8D, 0x01, 0x81, 0x4A, 0x88, 0x01, 0x81,
+    0x4A, 0x82, 0x01, 0x81, 0x4A, 0x82, 0x01, 0x81, 0x4A, 0x83, 0x01, 0x81, 0x4A, 0xFF, 0x01, 0xFF,
+    0x01, 0x92, 0x01, 0x81, 0x4A, 0x8D, 0x01, 0x81, 0x4A, 0x88, 0x01, 0x81, 0x4A, 0x82, 0x01, 0x81,
+    0x4A, 0x82, 0x01, 0x81, 0x4A, 0x83, 0x01, 0x02, 0x4F, 0x4A, 0x4C, 0xFF, 0x01, 0xFF, 0x01, 0x91,
+    0x01, 0x81, 0x4A, 0x8D, 0x01, 0x81, 0x4A, 0x88, 0x01, 0x81, 0x4A, 0x82, 0x01, 0x81, 0x4A, 0x82,
+    0x01, 0x81, 0x4A, 0x83, 0x01, 0x02, 0x4C, 0x4A, 0x4F, 0x86, 0x01, 0x01, 0x4D, 0x4B, 0x87, 0x01,
+    0x00, 0x52, 0x81, 0x4F, 0x00, 0x52, 0xFF, 0x01, 0xFC, 0x01, 0x81, 0x4A, 0x8D, 0x01, 0x81, 0x4A,
+    0x88, 0x01, 0x81, 0x4A, 0x82, 0x01, 0x81, 0x4A, 0x82, 0x01, 0x81, 0x4A, 0x84, 0x01, 0x02, 0x4F,
+    0x4A, 0x4D, 0x84, 0x01, 0x02, 0x4D, 0x4E, 0x4D, 0x87, 0x01, 0x00, 0x4F, 0x81, 0x4A, 0x00, 0x4F,
+    0xFF, 0x01, 0xFB, 0x01, 0x00, 0x4D, 0x81, 0x4A, 0x00, 0x4D, 0x8B, 0x01, 0x00, 0x4D, 0x81, 0x4A,
+    0x00, 0x4D, 0x86, 0x01, 0x00, 0x4D, 0x81, 0x4A, 0x02, 0x4D, 0x01, 0x4D, 0x81, 0x4A, 0x02, 0x4D,
+    0x01, 0x4D, 0x81, 0x4A, 0x00, 0x4D, 0x83, 0x01, 0x04, 0x52, 0x4F, 0x4A, 0x4F, 0x4C, 0x81, 0x01,
+    0x02, 0x4D, 0x4E, 0x49, 0x88, 0x01, 0x00, 0x4F, 0x81, 0x4A, 0x00, 0x4F, 0xFF, 0x01, 0xFA, 0x01,
+    0x00, 0x50, 0x83, 0x4A, 0x00, 0x50, 0x87, 0x01, 0x00, 0x50, 0x87, 0x4A, 0x00, 0x50, 0x83, 0x01,
+    0x00, 0x50, 0x81, 0x4A, 0x02, 0x50, 0x01, 0x50, 0x81, 0x4A, 0x02, 0x50, 0x01, 0x50, 0x81, 0x4A,
+    0x00, 0x50, 0x85, 0x01, 0x01, 0x4C, 0x4F, 0x82, 0x4A, 0x01, 0x4E, 0x4D, 0x89, 0x01, 0x00, 0x52,
+    0x81, 0x4F, 0x00, 0x52, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01,
+    0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01,
+    0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01,
+    0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01,
+    0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01,
+    0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01,
+    0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01,
+    0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01,
+    0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01,
+    0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01,
+    0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01,
+    0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01,
+    0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01,
+    0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01,
+    0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01,
+    0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01,
+    0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01,
+    0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01,
+    0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01,
+    0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01,
+    0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01,
+    0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01,
+    0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01,
+    0xFF, 0x01, 0xFF, 0x01, 0xB5, 0x01,
+};
+
+const lcd_picture_rle_t page1_bg_rle =
+{
+    320, 240, 83, page1_bg_palette, 7126, page1_bg_data,
+};
+
+/* page2_bg: 320x240, 13 colors, 153600 -> 5197 bytes */
+static const uint16_t page2_bg_palette[13] =
+{
+    0xFFFF, 0x0000, 0x01CF, 0x53D4, 0xADFA, 0xDF1D, 0x22B1, 0x3312,
+    0xBE5B, 0x4373, 0x1230, 0x9D79, 0x6455,
+};
+
+static const uint8_t page2_bg_data[5171] =
+{
+    0xB1, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00,
+    0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01,
+    0x8E, 0x00, 0x00, 0x02, 0x8C, 0x00, 0x00, 0x02, 0x83, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00, 0x02,
+    0x86, 0x00, 0x00, 0x02, 0x81, 0x00, 0x86, 0x02, 0x92, 0x00, 0x00, 0x01, 0x8F, 0x00, 0x00, 0x02,
+    0x8C, 0x00, 0x00, 0x02, 0x82, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00, 0x02, 0x86, 0x00, 0x00, 0x02,
+    0x81, 0x00, 0x86, 0x02, 0x92, 0x00, 0x00, 0x01, 0x8F, 0x00, 0x00, 0x02, 0x8C, 0x00, 0x00, 0x02,
+    0x82, 0x00, 0x00, 0x02, 0x8A, 0x00, 0x00, 0x02, 0x82, 0x00, 0x00, 0x02, 0x88, 0x00, 0x88, 0x02,
+    0xC5, 0x00, 0x00, 0x01, 0x8E, 0x00, 0x00, 0x02, 0x8C, 0x00, 0x00, 0x02, 0x83, 0x00, 0x00, 0x02,
+    0x87, 0x00, 0x83, 0x02, 0x84, 0x00, 0x00, 0x02, 0x87, 0x00, 0x00, 0x02, 0x86, 0x00, 0x00, 0x02,
+    0x92, 0x00, 0x00, 0x01, 0x8A, 0x00, 0x82, 0x02, 0x81, 0x00, 0x00, 0x02, 0x89, 0x00, 0x8A, 0x02,
+    0x84, 0x00, 0x83, 0x02, 0x84, 0x00, 0x00, 0x02, 0x87, 0x00, 0x00, 0x02, 0x86, 0x00, 0x00, 0x02,
+    0x92, 0x00, 0x00, 0x01, 0x8A, 0x00, 0x82, 0x02, 0x81, 0x00, 0x00, 0x02, 0x89, 0x00, 0x8A, 0x02,
+    0x85, 0x00, 0x06, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x88, 0x00, 0x00, 0x02, 0x82, 0x00,
+    0x00, 0x02, 0x82, 0x00, 0x00, 0x02, 0xC5, 0x00, 0x00, 0x01, 0x8A, 0x00, 0x8A, 0x02, 0x85, 0x00,
+    0x02, 0x02, 0x00, 0x02, 0x81, 0x00, 0x82, 0x02, 0x01, 0x00, 0x02, 0x84, 0x00, 0x00, 0x02, 0x81,
+    0x00, 0x00, 0x02, 0x84, 0x00, 0x00, 0x02, 0x8F, 0x00, 0x00, 0x02, 0x92, 0x00, 0x00, 0x01, 0x8A,
+    0x00, 0x02, 0x02, 0x00, 0x02, 0x81, 0x00, 0x85, 0x02, 0x87, 0x00, 0x00, 0x02, 0x82, 0x00, 0x00,
+    0x02, 0x87, 0x00, 0x00, 0x02, 0x81, 0x00, 0x00, 0x02, 0x84, 0x00, 0x00, 0x02, 0x8F, 0x00, 0x00,
+    0x02, 0x92, 0x00, 0x00, 0x01, 0x8A, 0x00, 0x02, 0x02, 0x00, 0x02, 0x81, 0x00, 0x85, 0x02, 0x87,
+    0x00, 0x00, 0x02, 0x82, 0x00, 0x00, 0x02, 0x8A, 0x00, 0x00, 0x02, 0x82, 0x00, 0x00, 0x02, 0x88,
+    0x00, 0x00, 0x02, 0x83, 0x00, 0x00, 0x02, 0x81, 0x00, 0x00, 0x02, 0xC5, 0x00, 0x00, 0x01, 0x8D,
+    0x00, 0x00, 0x02, 0x8C, 0x00, 0x00, 0x02, 0x84, 0x00, 0x02, 0x02, 0x00, 0x02, 0x85, 0x00, 0x00,
+    0x02, 0x81, 0x00, 0x01, 0x02, 0x00, 0x85, 0x02, 0x85, 0x00, 0x01, 0x02, 0x00, 0x85, 0x02, 0x01,
+    0x00, 0x02, 0x92, 0x00, 0x00, 0x01, 0x8A, 0x00, 0x04, 0x02, 0x00, 0x02, 0x00, 0x02, 0x8C, 0x00,
+    0x00, 0x02, 0x82, 0x00, 0x00, 0x02, 0x88, 0x00, 0x00, 0x02, 0x81, 0x00, 0x01, 0x02, 0x00, 0x85,
+    0x02, 0x85, 0x00, 0x01, 0x02, 0x00, 0x85, 0x02, 0x01, 0x00, 0x02, 0x92, 0x00, 0x00, 0x01, 0x8A,
+    0x00, 0x04, 0x02, 0x00, 0x02, 0x00, 0x02, 0x8C, 0x00, 0x00, 0x02, 0x82, 0x00, 0x00, 0x02, 0x88,
+    0x00, 0x85, 0x02, 0x00, 0x00, 0x83, 0x02, 0x84, 0x00, 0x8A, 0x02, 0xC4, 0x00, 0x00, 0x01, 0x8C,
+    0x00, 0x00, 0x02, 0x81, 0x00, 0x84, 0x02, 0x85, 0x00, 0x83, 0x02, 0x00, 0x00, 0x85, 0x02, 0x84,
+    0x00, 0x00, 0x02, 0x81, 0x00, 0x00, 0x02, 0x84, 0x00, 0x00, 0x02, 0x86, 0x00, 0x02, 0x02, 0x00,
+    0x02, 0x83, 0x00, 0x02, 0x02, 0x00, 0x02, 0x92, 0x00, 0x00, 0x01, 0x8A, 0x00, 0x01, 0x02, 0x00,
+    0x81, 0x02, 0x8C, 0x00, 0x00, 0x02, 0x81, 0x00, 0x01, 0x02, 0x00, 0x84, 0x02, 0x84, 0x00, 0x00,
+    0x02, 0x81, 0x00, 0x00, 0x02, 0x84, 0x00, 0x00, 0x02, 0x86, 0x00, 0x02, 0x02, 0x00, 0x02, 0x83,
+    0x00, 0x02, 0x02, 0x00, 0x02, 0x92, 0x00, 0x00, 0x01, 0x8A, 0x00, 0x01, 0x02, 0x00, 0x81, 0x02,
+    0x8C, 0x00, 0x00, 0x02, 0x81, 0x00, 0x01, 0x02, 0x00, 0x84, 0x02, 0x86, 0x00, 0x81, 0x02, 0x81,
+    0x00, 0x00, 0x02, 0x81, 0x00, 0x00, 0x02, 0x86, 0x00, 0x00, 0x02, 0x82, 0x00, 0x00, 0x02, 0x82,
+    0x00, 0x00, 0x02, 0xC5, 0x00, 0x00, 0x01, 0x8C, 0x00, 0x00, 0x02, 0x84, 0x00, 0x00, 0x02, 0x87,
+    0x00, 0x02, 0x02, 0x00, 0x02, 0x82, 0x00, 0x00, 0x02, 0x87, 0x00, 0x83, 0x02, 0x84, 0x00, 0x00,
+    0x02, 0x86, 0x00, 0x02, 0x02, 0x00, 0x02, 0x83, 0x00, 0x02, 0x02, 0x00, 0x02, 0x92, 0x00, 0x00,
+    0x01, 0x8A, 0x00, 0x03, 0x02, 0x00, 0x02, 0x00, 0x85, 0x02, 0x85, 0x00, 0x83, 0x02, 0x01, 0x00,
+    0x02, 0x83, 0x00, 0x00, 0x02, 0x84, 0x00, 0x83, 0x02, 0x84, 0x00, 0x00, 0x02, 0x86, 0x00, 0x02,
+    0x02, 0x00, 0x02, 0x83, 0x00, 0x02, 0x02, 0x00, 0x02, 0x92, 0x00, 0x00, 0x01, 0x8A, 0x00, 0x03,
+    0x02, 0x00, 0x02, 0x00, 0x85, 0x02, 0x85, 0x00, 0x83, 0x02, 0x01, 0x00, 0x02, 0x83, 0x00, 0x00,
+    0x02, 0x85, 0x00, 0x01, 0x02, 0x00, 0x81, 0x02, 0x81, 0x00, 0x02, 0x02, 0x00, 0x02, 0x86, 0x00,
+    0x88, 0x02, 0xC5, 0x00, 0x00, 0x01, 0x8B, 0x00, 0x81, 0x02, 0x83, 0x00, 0x00, 0x02, 0x88, 0x00,
+    0x02, 0x02, 0x00, 0x02, 0x81, 0x00, 0x83, 0x02, 0x85, 0x00, 0x00, 0x02, 0x81, 0x00, 0x00, 0x02,
+    0x81, 0x00, 0x00, 0x02, 0x81, 0x00, 0x00, 0x02, 0x86, 0x00, 0x01, 0x02, 0x00, 0x85, 0x02, 0x01,
+    0x00, 0x02, 0x92, 0x00, 0x00, 0x01, 0x8A, 0x00, 0x02, 0x02, 0x00, 0x02, 0x85, 0x00, 0x00, 0x02,
+    0x87, 0x00, 0x00, 0x02, 0x86, 0x00, 0x00, 0x02, 0x84, 0x00, 0x00, 0x02, 0x81, 0x00, 0x00, 0x02,
+    0x81, 0x00, 0x00, 0x02, 0x81, 0x00, 0x00, 0x02, 0x86, 0x00, 0x01, 0x02, 0x00, 0x85, 0x02, 0x01,
+    0x00, 0x02, 0x92, 0x00, 0x00, 0x01, 0x8A, 0x00, 0x02, 0x02, 0x00, 0x02, 0x85, 0x00, 0x00, 0x02,
+    0x87, 0x00, 0x00, 0x02, 0x86, 0x00, 0x00, 0x02, 0x84, 0x00, 0x00, 0x02, 0x81, 0x00, 0x06, 0x02,
+    0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x86, 0x00, 0x00, 0x02, 0x82, 0x00, 0x00, 0x02, 0x82, 0x00,
+    0x00, 0x02, 0xC5, 0x00, 0x00, 0x01, 0x8A, 0x00, 0x03, 0x02, 0x00, 0x02, 0x00, 0x86, 0x02, 0x85,
+    0x00, 0x03, 0x02, 0x00, 0x02, 0x00, 0x81, 0x02, 0x81, 0x00, 0x00, 0x02, 0x85, 0x00, 0x00, 0x02,
+    0x81, 0x00, 0x00, 0x02, 0x82, 0x00, 0x02, 0x02, 0x00, 0x02, 0x86, 0x00, 0x02, 0x02, 0x00, 0x02,
+    0x83, 0x00, 0x02, 0x02, 0x00, 0x02, 0x92, 0x00, 0x00, 0x01, 0x8A, 0x00, 0x02, 0x02, 0x00, 0x02,
+    0x83, 0x00, 0x81, 0x02, 0x87, 0x00, 0x00, 0x02, 0x83, 0x00, 0x00, 0x02, 0x82, 0x00, 0x00, 0x02,
+    0x84, 0x00, 0x00, 0x02, 0x81, 0x00, 0x00, 0x02, 0x82, 0x00, 0x02, 0x02, 0x00, 0x02, 0x86, 0x00,
+    0x02, 0x02, 0x00, 0x02, 0x83, 0x00, 0x02, 0x02, 0x00, 0x02, 0x92, 0x00, 0x00, 0x01, 0x8A, 0x00,
+    0x02, 0x02, 0x00, 0x02, 0x83, 0x00, 0x81, 0x02, 0x87, 0x00, 0x00, 0x02, 0x83, 0x00, 0x00, 0x02,
+    0x82, 0x00, 0x00, 0x02, 0x86, 0x00, 0x00, 0x02, 0x83, 0x00, 0x02, 0x02, 0x00, 0x02, 0x86, 0x00,
+    0x88, 0x02, 0xC5, 0x00, 0x00, 0x01, 0x8C, 0x00, 0x00, 0x02, 0x83, 0x00, 0x00, 0x02, 0x88, 0x00,
+    0x02, 0x02, 0x00, 0x02, 0x81, 0x00, 0x83, 0x02, 0x85, 0x00, 0x00, 0x02, 0x81, 0x00, 0x00, 0x02,
+    0x82, 0x00, 0x02, 0x02, 0x00, 0x02, 0x86, 0x00, 0x02, 0x02, 0x00, 0x02, 0x83, 0x00, 0x02, 0x02,
+    0x00, 0x02, 0x92, 0x00, 0x00, 0x01, 0x8A, 0x00, 0x82, 0x02, 0x81, 0x00, 0x81, 0x02, 0x88, 0x00,
+    0x84, 0x02, 0x81, 0x00, 0x00, 0x02, 0x81, 0x00, 0x00, 0x02, 0x84, 0x00, 0x00, 0x02, 0x81, 0x00,
+    0x00, 0x02, 0x82, 0x00, 0x02, 0x02, 0x00, 0x02, 0x86, 0x00, 0x02, 0x02, 0x00, 0x02, 0x83, 0x00,
+    0x02, 0x02, 0x00, 0x02, 0x92, 0x00, 0x00, 0x01, 0x8A, 0x00, 0x82, 0x02, 0x81, 0x00, 0x81, 0x02,
+    0x88, 0x00, 0x84, 0x02, 0x81, 0x00, 0x00, 0x02, 0x81, 0x00, 0x00, 0x02, 0x84, 0x00, 0x84, 0x02,
+    0x81, 0x00, 0x02, 0x02, 0x00, 0x02, 0x8A, 0x00, 0x00, 0x02, 0xC9, 0x00, 0x00, 0x01, 0x8C, 0x00,
+    0x00, 0x02, 0x83, 0x00, 0x00, 0x02, 0x88, 0x00, 0x01, 0x02, 0x00, 0x81, 0x02, 0x01, 0x00, 0x02,
+    0x81, 0x00, 0x00, 0x02, 0x85, 0x00, 0x83, 0x02, 0x84, 0x00, 0x00, 0x02, 0x86, 0x00, 0x01, 0x02,
+    0x00, 0x85, 0x02, 0x01, 0x00, 0x02, 0x92, 0x00, 0x00, 0x01, 0x8A, 0x00, 0x04, 0x02, 0x00, 0x02,
+    0x00, 0x02, 0x84, 0x00, 0x00, 0x02, 0x8E, 0x00, 0x00, 0x02, 0x84, 0x00, 0x83, 0x02, 0x84, 0x00,
+    0x00, 0x02, 0x86, 0x00, 0x01, 0x02, 0x00, 0x85, 0x02, 0x01, 0x00, 0x02, 0x92, 0x00, 0x00, 0x01,
+    0x8A, 0x00, 0x04, 0x02, 0x00, 0x02, 0x00, 0x02, 0x84, 0x00, 0x00, 0x02, 0x8E, 0x00, 0x00, 0x02,
+    0x85, 0x00, 0x00, 0x02, 0x81, 0x00, 0x00, 0x02, 0x82, 0x00, 0x00, 0x02, 0x87, 0x00, 0x88, 0x02,
+    0xC5, 0x00, 0x00, 0x01, 0x8C, 0x00, 0x00, 0x02, 0x83, 0x00, 0x00, 0x02, 0x88, 0x00, 0x02, 0x02,
+    0x00, 0x02, 0x81, 0x00, 0x83, 0x02, 0x85, 0x00, 0x00, 0x02, 0x81, 0x00, 0x00, 0x02, 0x84, 0x00,
+    0x00, 0x02, 0x86, 0x00, 0x00, 0x02, 0x87, 0x00, 0x00, 0x02, 0x92, 0x00, 0x00, 0x01, 0x8E, 0x00,
+    0x00, 0x02, 0x84, 0x00, 0x00, 0x02, 0x87, 0x00, 0x82, 0x02, 0x83, 0x00, 0x00, 0x02, 0x84, 0x00,
+    0x00, 0x02, 0x81, 0x00, 0x00, 0x02, 0x84, 0x00, 0x00, 0x02, 0x86, 0x00, 0x00, 0x02, 0x87, 0x00,
+    0x00, 0x02, 0x92, 0x00, 0x00, 0x01, 0x8E, 0x00, 0x00, 0x02, 0x84, 0x00, 0x00, 0x02, 0x87, 0x00,
+    0x82, 0x02, 0x83, 0x00, 0x00, 0x02, 0x86, 0x00, 0x81, 0x02, 0x82, 0x00, 0x02, 0x02, 0x00, 0x02,
+    0x8A, 0x00, 0x00, 0x02, 0xC9, 0x00, 0x00, 0x01, 0x8C, 0x00, 0x00, 0x02, 0x82, 0x00, 0x81, 0x02,
+    0x88, 0x00, 0x00, 0x02, 0x83, 0x00, 0x00, 0x02, 0x81, 0x00, 0x00, 0x02, 0x8C, 0x00, 0x82, 0x02,
+    0x86, 0x00, 0x00, 0x02, 0x85, 0x00, 0x82, 0x02, 0x92, 0x00, 0x00, 0x01, 0x8F, 0x00, 0x85, 0x02,
+    0x84, 0x00, 0x82, 0x02, 0x84, 0x00, 0x81, 0x02, 0x8C, 0x00, 0x82, 0x02, 0x86, 0x00, 0x00, 0x02,
+    0x85, 0x00, 0x82, 0x02, 0x92, 0x00, 0x00, 0x01, 0x8F, 0x00, 0x85, 0x02, 0x84, 0x00, 0x82, 0x02,
+    0x84, 0x00, 0x81, 0x02, 0x85, 0x00, 0x81, 0x02, 0x81, 0x00, 0x02, 0x02, 0x00, 0x02, 0x82, 0x00,
+    0x00, 0x02, 0x84, 0x00, 0x8A, 0x02, 0xC4, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00,
+    0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01,
+    0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00,
+    0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00,
+    0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01,
+    0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00,
+    0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01,
+    0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00,
+    0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01,
+    0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00,
+    0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00,
+    0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01,
+    0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00,
+    0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01,
+    0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0xFF, 0x01, 0xFF, 0x01, 0xBF, 0x01, 0xB1, 0x00, 0x00, 0x01,
+    0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00,
+    0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01,
+    0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00,
+    0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01,
+    0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00,
+    0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xA2, 0x00, 0x81, 0x02, 0xB3, 0x00, 0x00, 0x01,
+    0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xA2, 0x00, 0x81, 0x02, 0xB3, 0x00,
+    0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01,
+    0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00,
+    0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00,
+    0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01,
+    0xD8, 0x00, 0x00, 0x01, 0xA2, 0x00, 0x81, 0x02, 0xB3, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00,
+    0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xA2, 0x00, 0x81, 0x02, 0xB3, 0x00, 0x00, 0x01, 0xFF, 0x00,
+    0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00,
+    0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01,
+    0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00,
+    0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01,
+    0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00,
+    0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01,
+    0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00,
+    0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0xFF, 0x01, 0xB3, 0x01, 0xB1, 0x00, 0x00, 0x01, 0xD8, 0x00,
+    0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01,
+    0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00,
+    0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01,
+    0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00,
+    0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00,
+    0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xA2, 0x00, 0x81, 0x02, 0xB3, 0x00, 0x00, 0x01, 0xFF, 0x00,
+    0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xA2, 0x00, 0x81, 0x02, 0xB3, 0x00, 0x00, 0x01,
+    0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00,
+    0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00,
+    0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01,
+    0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00,
+    0x00, 0x01, 0xA2, 0x00, 0x81, 0x02, 0xB3, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01,
+    0xD8, 0x00, 0x00, 0x01, 0xA2, 0x00, 0x81, 0x02, 0xB3, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00,
+    0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01,
+    0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00,
+    0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xF6, 0x00, 0x00, 0x03, 0x89, 0x02, 0x00, 0x03, 0x87, 0x00,
+    0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xF6, 0x00, 0x01, 0x02, 0x04, 0x87,
+    0x00, 0x01, 0x04, 0x02, 0x87, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01,
+    0xF6, 0x00, 0x00, 0x02, 0x89, 0x00, 0x00, 0x02, 0x87, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01,
+    0xD8, 0x00, 0x00, 0x01, 0xF6, 0x00, 0x00, 0x02, 0x89, 0x00, 0x00, 0x02, 0x87, 0x00, 0x00, 0x01,
+    0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xF6, 0x00, 0x00, 0x02, 0x89, 0x00, 0x00, 0x02,
+    0x87, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xF6, 0x00, 0x01, 0x02,
+    0x04, 0x87, 0x00, 0x01, 0x04, 0x02, 0x87, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00,
+    0x00, 0x01, 0xF6, 0x00, 0x8B, 0x02, 0x87, 0x00, 0x00, 0x01, 0xD8, 0x00, 0xFF, 0x01, 0xB3, 0x01,
+    0x9C, 0x00, 0x02, 0x04, 0x02, 0x05, 0x87, 0x00, 0x02, 0x05, 0x02, 0x04, 0x86, 0x00, 0x00, 0x01,
+    0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xF2, 0x00, 0x00, 0x06, 0x91, 0x02, 0x00, 0x06,
+    0x83, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xF7, 0x00, 0x03, 0x04,
+    0x02, 0x07, 0x08, 0x8E, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xEB,
+    0x00, 0x02, 0x04, 0x06, 0x04, 0x88, 0x00, 0x02, 0x08, 0x02, 0x08, 0x8F, 0x00, 0x00, 0x01, 0xD8,
+    0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD9, 0x00, 0x00, 0x06, 0x92, 0x02, 0x00, 0x06, 0x88,
+    0x00, 0x02, 0x09, 0x02, 0x04, 0x8F, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00,
+    0x01, 0xF7, 0x00, 0x8A, 0x02, 0x00, 0x03, 0x86, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8,
+    0x00, 0x00, 0x01, 0xF7, 0x00, 0x01, 0x06, 0x04, 0x86, 0x00, 0x02, 0x04, 0x02, 0x09, 0x86, 0x00,
+    0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xA2, 0x00, 0x81, 0x02, 0xB3, 0x00, 0x00, 0x01, 0xFF, 0x00,
+    0x81, 0x00, 0x01, 0x02, 0x08, 0x86, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xA2, 0x00, 0x81,
+    0x02, 0xB3, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x81, 0x00, 0x00, 0x02, 0x87, 0x00, 0x00, 0x01, 0xD8,
+    0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x02, 0x00, 0x08, 0x02, 0x87, 0x00, 0x00,
+    0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x81, 0x09, 0x87,
+    0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFB, 0x00, 0x06, 0x06, 0x0A,
+    0x0B, 0x00, 0x04, 0x02, 0x08, 0x87, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00,
+    0x01, 0xFC, 0x00, 0x01, 0x0B, 0x0C, 0x81, 0x02, 0x00, 0x03, 0x88, 0x00, 0x00, 0x01, 0xD8, 0x00,
+    0x00, 0x01, 0xA2, 0x00, 0x81, 0x02, 0xB3, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x02, 0x03, 0x09, 0x08,
+    0x89, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xA2, 0x00, 0x81, 0x02, 0xB3, 0x00, 0x00, 0x01,
+    0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00,
+    0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00,
+    0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01,
+    0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00,
+    0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01,
+    0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00,
+    0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01,
+    0xD8, 0x00, 0xFF, 0x01, 0xFF, 0x01, 0xBF, 0x01, 0xB1, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01,
+    0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00,
+    0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01,
+    0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00,
+    0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00,
+    0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01,
+    0xD8, 0x00, 0x00, 0x01, 0xA2, 0x00, 0x81, 0x02, 0xB3, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00,
+    0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xA2, 0x00, 0x81, 0x02, 0xB3, 0x00, 0x00, 0x01, 0xFF, 0x00,
+    0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00,
+    0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01,
+    0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00,
+    0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01,
+    0xA2, 0x00, 0x81, 0x02, 0xB3, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00,
+    0x00, 0x01, 0xA2, 0x00, 0x81, 0x02, 0xB3, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01,
+    0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00,
+    0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01,
+    0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00,
+    0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01,
+    0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00,
+    0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00,
+    0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01,
+    0xD8, 0x00, 0xFF, 0x01, 0xB3, 0x01, 0xB1, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00,
+    0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01,
+    0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00,
+    0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00,
+    0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01,
+    0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00,
+    0x00, 0x01, 0xA2, 0x00, 0x81, 0x02, 0xB3, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01,
+    0xD8, 0x00, 0x00, 0x01, 0xA2, 0x00, 0x81, 0x02, 0xB3, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00,
+    0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01,
+    0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00,
+    0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01,
+    0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xA2, 0x00,
+    0x81, 0x02, 0xB3, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01,
+    0xA2, 0x00, 0x81, 0x02, 0xB3, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00,
+    0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01,
+    0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00,
+    0x00, 0x01, 0xF6, 0x00, 0x00, 0x03, 0x89, 0x02, 0x00, 0x03, 0x87, 0x00, 0x00, 0x01, 0xD8, 0x00,
+    0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xF6, 0x00, 0x01, 0x02, 0x04, 0x87, 0x00, 0x01, 0x04, 0x02,
+    0x87, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xF6, 0x00, 0x00, 0x02,
+    0x89, 0x00, 0x00, 0x02, 0x87, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01,
+    0xE9, 0x00, 0x02, 0x04, 0x06, 0x04, 0x89, 0x00, 0x00, 0x02, 0x89, 0x00, 0x00, 0x02, 0x87, 0x00,
+    0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xDC, 0x00, 0x00, 0x06, 0x8D, 0x02,
+    0x00, 0x06, 0x89, 0x00, 0x00, 0x02, 0x89, 0x00, 0x00, 0x02, 0x87, 0x00, 0x00, 0x01, 0xD8, 0x00,
+    0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xF6, 0x00, 0x01, 0x02, 0x04, 0x87, 0x00, 0x01, 0x04, 0x02,
+    0x87, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xF6, 0x00, 0x8B, 0x02,
+    0x87, 0x00, 0x00, 0x01, 0xD8, 0x00, 0xFF, 0x01, 0xB3, 0x01, 0x9C, 0x00, 0x02, 0x04, 0x02, 0x05,
+    0x87, 0x00, 0x02, 0x05, 0x02, 0x04, 0x86, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00,
+    0x00, 0x01, 0xF2, 0x00, 0x00, 0x06, 0x91, 0x02, 0x00, 0x06, 0x83, 0x00, 0x00, 0x01, 0xD8, 0x00,
+    0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xF7, 0x00, 0x03, 0x04, 0x02, 0x07, 0x08, 0x8E, 0x00, 0x00,
+    0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xF7, 0x00, 0x02, 0x08, 0x02, 0x08, 0x8F,
+    0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xF7, 0x00, 0x02, 0x09, 0x02,
+    0x04, 0x8F, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xF7, 0x00, 0x8A,
+    0x02, 0x00, 0x03, 0x86, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xF7,
+    0x00, 0x01, 0x06, 0x04, 0x86, 0x00, 0x02, 0x04, 0x02, 0x09, 0x86, 0x00, 0x00, 0x01, 0xD8, 0x00,
+    0x00, 0x01, 0xA2, 0x00, 0x81, 0x02, 0xB3, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x81, 0x00, 0x01, 0x02,
+    0x08, 0x86, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xA2, 0x00, 0x81, 0x02, 0xB3, 0x00, 0x00,
+    0x01, 0xFF, 0x00, 0x81, 0x00, 0x00, 0x02, 0x87, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8,
+    0x00, 0x00, 0x01, 0xEB, 0x00, 0x02, 0x04, 0x06, 0x04, 0x91, 0x00, 0x01, 0x08, 0x02, 0x87, 0x00,
+    0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD9, 0x00, 0x00, 0x06, 0x92, 0x02,
+    0x00, 0x06, 0x91, 0x00, 0x81, 0x09, 0x87, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00,
+    0x00, 0x01, 0xFB, 0x00, 0x06, 0x06, 0x0A, 0x0B, 0x00, 0x04, 0x02, 0x08, 0x87, 0x00, 0x00, 0x01,
+    0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x01, 0x0B, 0x0C, 0x81, 0x02, 0x00,
+    0x03, 0x88, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xA2, 0x00, 0x81, 0x02, 0xB3, 0x00, 0x00,
+    0x01, 0xFD, 0x00, 0x02, 0x03, 0x09, 0x08, 0x89, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xA2,
+    0x00, 0x81, 0x02, 0xB3, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00,
+    0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8,
+    0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00,
+    0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF,
+    0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A,
+    0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00,
+    0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8,
+    0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0xFF, 0x01, 0xFF, 0x01, 0xBF, 0x01, 0xB1,
+    0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00,
+    0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8,
+    0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00,
+    0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8,
+    0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00,
+    0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xA2, 0x00, 0x81, 0x02, 0xB3,
+    0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xA2, 0x00, 0x81,
+    0x02, 0xB3, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8,
+    0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00,
+    0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF,
+    0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A,
+    0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xA2, 0x00, 0x81, 0x02, 0xB3, 0x00, 0x00, 0x01, 0xFF,
+    0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xA2, 0x00, 0x81, 0x02, 0xB3, 0x00, 0x00,
+    0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF,
+    0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A,
+    0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00,
+    0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8,
+    0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00,
+    0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8,
+    0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00,
+    0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0xFF, 0x01, 0xB3, 0x01, 0xB1, 0x00, 0x00,
+    0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8,
+    0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00,
+    0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8,
+    0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00,
+    0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF,
+    0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xA2, 0x00, 0x81, 0x02, 0xB3, 0x00, 0x00,
+    0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xA2, 0x00, 0x81, 0x02, 0xB3,
+    0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00,
+    0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF,
+    0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A,
+    0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00,
+    0x01, 0xD8, 0x00, 0x00, 0x01, 0xA2, 0x00, 0x81, 0x02, 0xB3, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A,
+    0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xA2, 0x00, 0x81, 0x02, 0xB3, 0x00, 0x00, 0x01, 0xFF,
+    0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A,
+    0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00,
+    0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xF6, 0x00, 0x00, 0x03, 0x89, 0x02, 0x00,
+    0x03, 0x87, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xF6, 0x00, 0x01,
+    0x02, 0x04, 0x87, 0x00, 0x01, 0x04, 0x02, 0x87, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8,
+    0x00, 0x00, 0x01, 0xEA, 0x00, 0x02, 0x04, 0x06, 0x04, 0x88, 0x00, 0x00, 0x02, 0x89, 0x00, 0x00,
+    0x02, 0x87, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xDB, 0x00, 0x00,
+    0x06, 0x8F, 0x02, 0x00, 0x06, 0x88, 0x00, 0x00, 0x02, 0x89, 0x00, 0x00, 0x02, 0x87, 0x00, 0x00,
+    0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xF6, 0x00, 0x00, 0x02, 0x89, 0x00, 0x00,
+    0x02, 0x87, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xF6, 0x00, 0x01,
+    0x02, 0x04, 0x87, 0x00, 0x01, 0x04, 0x02, 0x87, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8,
+    0x00, 0x00, 0x01, 0xF6, 0x00, 0x8B, 0x02, 0x87, 0x00, 0x00, 0x01, 0xD8, 0x00, 0xFF, 0x01, 0xB3,
+    0x01, 0x9C, 0x00, 0x02, 0x04, 0x02, 0x05, 0x87, 0x00, 0x02, 0x05, 0x02, 0x04, 0x86, 0x00, 0x00,
+    0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xF2, 0x00, 0x00, 0x06, 0x91, 0x02, 0x00,
+    0x06, 0x83, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xF7, 0x00, 0x03,
+    0x04, 0x02, 0x07, 0x08, 0x8E, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01,
+    0xE8, 0x00, 0x02, 0x04, 0x06, 0x04, 0x8B, 0x00, 0x02, 0x08, 0x02, 0x08, 0x8F, 0x00, 0x00, 0x01,
+    0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xDC, 0x00, 0x00, 0x06, 0x8C, 0x02, 0x00, 0x06,
+    0x8B, 0x00, 0x02, 0x09, 0x02, 0x04, 0x8F, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00,
+    0x00, 0x01, 0xF7, 0x00, 0x8A, 0x02, 0x00, 0x03, 0x86, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01,
+    0xD8, 0x00, 0x00, 0x01, 0xF7, 0x00, 0x01, 0x06, 0x04, 0x86, 0x00, 0x02, 0x04, 0x02, 0x09, 0x86,
+    0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xA2, 0x00, 0x81, 0x02, 0xB3, 0x00, 0x00, 0x01, 0xFF,
+    0x00, 0x81, 0x00, 0x01, 0x02, 0x08, 0x86, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xA2, 0x00,
+    0x81, 0x02, 0xB3, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x81, 0x00, 0x00, 0x02, 0x87, 0x00, 0x00, 0x01,
+    0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x02, 0x00, 0x08, 0x02, 0x87, 0x00,
+    0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x81, 0x09,
+    0x87, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xEB, 0x00, 0x00, 0x08,
+    0x81, 0x09, 0x00, 0x08, 0x8B, 0x00, 0x06, 0x06, 0x0A, 0x0B, 0x00, 0x04, 0x02, 0x08, 0x87, 0x00,
+    0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD9, 0x00, 0x00, 0x06, 0x93, 0x02,
+    0x00, 0x06, 0x8C, 0x00, 0x01, 0x0B, 0x0C, 0x81, 0x02, 0x00, 0x03, 0x88, 0x00, 0x00, 0x01, 0xD8,
+    0x00, 0x00, 0x01, 0xA2, 0x00, 0x81, 0x02, 0xB3, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x02, 0x03, 0x09,
+    0x08, 0x89, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xA2, 0x00, 0x81, 0x02, 0xB3, 0x00, 0x00,
+    0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF,
+    0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A,
+    0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00,
+    0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8,
+    0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00,
+    0x01, 0xD8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8,
+    0x00, 0x00, 0x01, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x01, 0xD8, 0x00, 0x00,
+    0x01, 0xD8, 0x00,
+};
+
+const lcd_picture_rle_t page2_bg_rle =
+{
+    320, 240, 13, page2_bg_palette, 5171, page2_bg_data,
+};
+
+/* page3_bg: 320x240, 15 colors, 153600 -> 1934 bytes */
+static const uint16_t page3_bg_palette[15] =
+{
+    0xFFFF, 0xC4C4, 0xBC40, 0xD58A, 0xE6B5, 0xEEF7, 0xCD48, 0xEF39,
+    0xC482, 0xCD06, 0xF77B, 0xF7BD, 0xD5CC, 0xE673, 0x0000,
+};
+
+static const uint8_t page3_bg_data[1904] =
+{
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xBF, 0x00, 0x00, 0x01, 0x81, 0x02, 0x00, 0x01, 0x83, 0x00, 0x00, 0x01, 0x81, 0x02,
+    0x00, 0x01, 0x84, 0x00, 0x81, 0x03, 0xFF, 0x00, 0xFF, 0x00, 0xAC, 0x00, 0x00, 0x04, 0x81, 0x02,
+    0x00, 0x04, 0x83, 0x00, 0x00, 0x04, 0x81, 0x02, 0x00, 0x04, 0x84, 0x00, 0x81, 0x03, 0x95, 0x00,
+    0x00, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0x96, 0x00, 0x81, 0x02, 0x85, 0x00, 0x81, 0x02, 0x9C, 0x00,
+    0x01, 0x05, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0x96, 0x00, 0x81, 0x02, 0x85, 0x00, 0x81, 0x02, 0x9C,
+    0x00, 0x01, 0x06, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0x96, 0x00, 0x81, 0x02, 0x85, 0x00, 0x81, 0x02,
+    0x85, 0x00, 0x01, 0x04, 0x01, 0x93, 0x00, 0x00, 0x04, 0x81, 0x02, 0x00, 0x04, 0xFF, 0x00, 0xFF,
+    0x00, 0x95, 0x00, 0x81, 0x02, 0x85, 0x00, 0x81, 0x02, 0x82, 0x00, 0x00, 0x01, 0x83, 0x02, 0x87,
+    0x00, 0x01, 0x05, 0x06, 0x83, 0x02, 0x00, 0x03, 0x82, 0x00, 0x00, 0x01, 0x85, 0x02, 0x00, 0x01,
+    0x85, 0x00, 0x01, 0x07, 0x06, 0x81, 0x02, 0x01, 0x06, 0x07, 0x82, 0x00, 0x00, 0x01, 0x82, 0x02,
+    0x06, 0x03, 0x00, 0x04, 0x08, 0x02, 0x06, 0x07, 0x81, 0x00, 0x00, 0x01, 0x81, 0x02, 0x00, 0x01,
+    0x81, 0x00, 0x00, 0x01, 0x81, 0x02, 0x00, 0x01, 0xFF, 0x00, 0xED, 0x00, 0x81, 0x02, 0x00, 0x04,
+    0x83, 0x00, 0x00, 0x04, 0x81, 0x02, 0x84, 0x00, 0x00, 0x04, 0x81, 0x02, 0x86, 0x00, 0x07, 0x03,
+    0x02, 0x09, 0x05, 0x00, 0x05, 0x09, 0x02, 0x84, 0x00, 0x00, 0x04, 0x81, 0x02, 0x00, 0x04, 0x86,
+    0x00, 0x00, 0x07, 0x81, 0x09, 0x81, 0x05, 0x81, 0x09, 0x00, 0x07, 0x83, 0x00, 0x00, 0x04, 0x81,
+    0x02, 0x01, 0x0A, 0x01, 0x81, 0x04, 0x01, 0x02, 0x06, 0x82, 0x00, 0x02, 0x04, 0x02, 0x04, 0x81,
+    0x00, 0x02, 0x04, 0x02, 0x04, 0xFF, 0x00, 0xEE, 0x00, 0x89, 0x02, 0x85, 0x00, 0x81, 0x02, 0x86,
+    0x00, 0x81, 0x02, 0x00, 0x05, 0x82, 0x00, 0x01, 0x05, 0x02, 0x85, 0x00, 0x81, 0x02, 0x86, 0x00,
+    0x00, 0x07, 0x81, 0x09, 0x00, 0x07, 0x81, 0x00, 0x00, 0x07, 0x81, 0x09, 0x00, 0x07, 0x83, 0x00,
+    0x81, 0x02, 0x01, 0x08, 0x04, 0x81, 0x00, 0x81, 0x03, 0x83, 0x00, 0x00, 0x02, 0x83, 0x00, 0x00,
+    0x02, 0xFF, 0x00, 0xEF, 0x00, 0x81, 0x02, 0x00, 0x04, 0x83, 0x00, 0x00, 0x04, 0x81, 0x02, 0x85,
+    0x00, 0x81, 0x02, 0x86, 0x00, 0x02, 0x06, 0x02, 0x04, 0x83, 0x00, 0x00, 0x01, 0x85, 0x00, 0x81,
+    0x02, 0x86, 0x00, 0x02, 0x06, 0x02, 0x05, 0x83, 0x00, 0x02, 0x05, 0x02, 0x06, 0x83, 0x00, 0x81,
+    0x02, 0x00, 0x04, 0x88, 0x00, 0x01, 0x08, 0x04, 0x81, 0x00, 0x01, 0x04, 0x08, 0xFF, 0x00, 0xEF,
+    0x00, 0x81, 0x02, 0x85, 0x00, 0x81, 0x02, 0x85, 0x00, 0x81, 0x02, 0x86, 0x00, 0x04, 0x07, 0x09,
+    0x02, 0x06, 0x05, 0x88, 0x00, 0x81, 0x02, 0x86, 0x00, 0x81, 0x02, 0x85, 0x00, 0x81, 0x02, 0x83,
+    0x00, 0x81, 0x02, 0x89, 0x00, 0x01, 0x04, 0x08, 0x81, 0x00, 0x01, 0x08, 0x04, 0xFF, 0x00, 0xEF,
+    0x00, 0x81, 0x02, 0x85, 0x00, 0x81, 0x02, 0x85, 0x00, 0x81, 0x02, 0x87, 0x00, 0x01, 0x07, 0x06,
+    0x81, 0x02, 0x01, 0x06, 0x05, 0x86, 0x00, 0x81, 0x02, 0x86, 0x00, 0x81, 0x02, 0x85, 0x00, 0x81,
+    0x02, 0x83, 0x00, 0x81, 0x02, 0x8A, 0x00, 0x03, 0x02, 0x05, 0x00, 0x02, 0xFF, 0x00, 0xF0, 0x00,
+    0x81, 0x02, 0x85, 0x00, 0x81, 0x02, 0x85, 0x00, 0x81, 0x02, 0x89, 0x00, 0x01, 0x05, 0x06, 0x81,
+    0x02, 0x00, 0x03, 0x85, 0x00, 0x81, 0x02, 0x86, 0x00, 0x81, 0x02, 0x85, 0x00, 0x81, 0x02, 0x83,
+    0x00, 0x81, 0x02, 0x8A, 0x00, 0x81, 0x06, 0x01, 0x0B, 0x08, 0xFF, 0x00, 0xF0, 0x00, 0x81, 0x02,
+    0x85, 0x00, 0x81, 0x02, 0x85, 0x00, 0x81, 0x02, 0x86, 0x00, 0x00, 0x01, 0x83, 0x00, 0x00, 0x04,
+    0x81, 0x02, 0x85, 0x00, 0x81, 0x02, 0x86, 0x00, 0x02, 0x06, 0x02, 0x05, 0x83, 0x00, 0x02, 0x05,
+    0x02, 0x06, 0x83, 0x00, 0x81, 0x02, 0x8A, 0x00, 0x03, 0x05, 0x02, 0x0C, 0x0D, 0xFF, 0x00, 0xF0,
+    0x00, 0x81, 0x02, 0x85, 0x00, 0x81, 0x02, 0x85, 0x00, 0x81, 0x02, 0x86, 0x00, 0x01, 0x02, 0x05,
+    0x82, 0x00, 0x00, 0x05, 0x81, 0x02, 0x85, 0x00, 0x81, 0x02, 0x82, 0x00, 0x00, 0x01, 0x82, 0x00,
+    0x02, 0x05, 0x02, 0x06, 0x83, 0x00, 0x02, 0x06, 0x02, 0x05, 0x83, 0x00, 0x81, 0x02, 0x8B, 0x00,
+    0x81, 0x02, 0xFF, 0x00, 0xF0, 0x00, 0x00, 0x04, 0x81, 0x02, 0x00, 0x04, 0x83, 0x00, 0x00, 0x04,
+    0x81, 0x02, 0x00, 0x04, 0x83, 0x00, 0x00, 0x04, 0x81, 0x02, 0x00, 0x04, 0x85, 0x00, 0x07, 0x02,
+    0x09, 0x05, 0x00, 0x05, 0x09, 0x02, 0x06, 0x85, 0x00, 0x05, 0x06, 0x02, 0x04, 0x00, 0x04, 0x08,
+    0x83, 0x00, 0x02, 0x03, 0x0C, 0x0D, 0x81, 0x00, 0x02, 0x0D, 0x0C, 0x03, 0x83, 0x00, 0x00, 0x04,
+    0x81, 0x02, 0x00, 0x04, 0x8A, 0x00, 0x01, 0x02, 0x06, 0xFF, 0x00, 0xF0, 0x00, 0x00, 0x01, 0x81,
+    0x02, 0x00, 0x01, 0x83, 0x00, 0x00, 0x01, 0x81, 0x02, 0x00, 0x01, 0x81, 0x00, 0x00, 0x01, 0x85,
+    0x02, 0x00, 0x01, 0x83, 0x00, 0x00, 0x03, 0x84, 0x02, 0x01, 0x06, 0x07, 0x85, 0x00, 0x01, 0x07,
+    0x06, 0x81, 0x02, 0x01, 0x08, 0x04, 0x84, 0x00, 0x01, 0x0D, 0x08, 0x81, 0x02, 0x01, 0x08, 0x0D,
+    0x82, 0x00, 0x00, 0x01, 0x85, 0x02, 0x00, 0x01, 0x88, 0x00, 0x01, 0x02, 0x05, 0xFF, 0x00, 0xFF,
+    0x00, 0xBD, 0x00, 0x00, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0xBB, 0x00, 0x00, 0x01, 0x81, 0x04, 0x00,
+    0x08, 0xFF, 0x00, 0xFF, 0x00, 0xBB, 0x00, 0x03, 0x03, 0x02, 0x08, 0x04, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xB1, 0x00,
+    0xFF, 0x0E, 0xFF, 0x0E, 0xBF, 0x0E, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+};
+
+const lcd_picture_rle_t page3_bg_rle =
+{
+    320, 240, 15, page3_bg_palette, 1904, page3_bg_data,
+};
@@ -17,7 +17,11 @@
 
 #include <stdio.h>
 #include <stdbool.h>
+#include <string.h>
 
+#include "los_task.h"
+#include "los_queue.h"
+#include "los_sem.h"
 #include "iot_errno.h"
 
 #include "iot_pwm.h"
@@ -27,8 +31,229 @@
 #include "lcd.h"
 #include "picture.h"
 #include "adc_key.h"
-#include "lcd.h"
-#include "string.h"
+#include "lcd_widget.h"
+
+/* 设置页面中选中项的背景色 */
+#define UI_BC(ui, n)        (((ui)->dis2 == (n)) ? LCD_GRAY : LCD_WHITE)
+
+/* 页面0：三个药盒本次吃药数量及下次吃药时间 */
+enum
+{
+    P0_COUNT = 7,           // 本次吃药数量，共3个
+    P0_TIME = 11,           // 下次吃药时间
+    P0_NUM
+};
+
+static lcd_widget_t m_page0[P0_NUM] =
+{
+    LCD_WIDGET_FIXED_LINE(107, 0, 107, 200, LCD_BLACK),
+    LCD_WIDGET_FIXED_LINE(214, 0, 214, 200, LCD_BLACK),
+    LCD_WIDGET_FIXED_LINE(0, 100, 320, 100, LCD_BLACK),
+    LCD_WIDGET_FIXED_LINE(0, 200, 320, 200, LCD_BLACK),
+    LCD_WIDGET_FIXED_LABEL(1, 1, "一号药盒", LCD_DARKBLUE, LCD_WHITE, 24),
+    LCD_WIDGET_FIXED_LABEL(108, 1, "二号药盒", LCD_DARKBLUE, LCD_WHITE, 24),
+    LCD_WIDGET_FIXED_LABEL(215, 1, "三号药盒", LCD_DARKBLUE, LCD_WHITE, 24),
+    LCD_WIDGET_NUMBER(5, 105, 3, LCD_DARKBLUE, LCD_WHITE, 32),
+    LCD_WIDGET_NUMBER(112, 105, 3, LCD_DARKBLUE, LCD_WHITE, 32),
+    LCD_WIDGET_NUMBER(219, 105, 3, LCD_DARKBLUE, LCD_WHITE, 32),
+    LCD_WIDGET_FIXED_LABEL(0, 210, "Next Time:", LCD_BROWN, LCD_WHITE, 32),
+    LCD_WIDGET_TIME(170, 230, 250, 210, 3, LCD_DARKBLUE, LCD_WHITE, 32),
+};
+
+/* 页面1：环境数据及当前时间 */
+enum
+{
+    P1_LUM = 1,
+    P1_HUMI = 3,
+    P1_TEMP = 5,
+    P1_GAS = 7,
+    P1_TIME = 9,
+    P1_NUM
+};
+
+static lcd_widget_t m_page1[P1_NUM] =
+{
+    LCD_WIDGET_FIXED_ICON_RLE(0, 0, &Light_picture_rle),
+    LCD_WIDGET_FLOAT(0, 84, 5, LCD_DARKBLUE, LCD_WHITE, 24),
+    LCD_WIDGET_FIXED_ICON_RLE(84, 0, &humidity_picture_rle),
+    LCD_WIDGET_FLOAT(84, 84, 4, LCD_DARKBLUE, LCD_WHITE, 24),
+    LCD_WIDGET_FIXED_ICON_RLE(168, 0, &temperature_picture_rle),
+    LCD_WIDGET_FLOAT(168, 84, 4, LCD_DARKBLUE, LCD_WHITE, 24),
+    LCD_WIDGET_FIXED_ICON_RLE(252, 0, &gas_picture_rle),
+    LCD_WIDGET_FLOAT(252, 84, 4, LCD_DARKBLUE, LCD_WHITE, 24),
+    LCD_WIDGET_FIXED_LABEL(0, 140, "Time:", LCD_BROWN, LCD_WHITE, 32),
+    LCD_WIDGET_TIME(150, 215, 248, 140, 2, LCD_DARKBLUE, LCD_WHITE, 32),
+};
+
+/* 页面1下方的环境数据曲线，与上方图标对齐，
+ * 采样值与数值控件一样放大100倍，范围参考报警阈值 */
+#define P1_CHART_Y          180
+#define P1_CHART_W          (SMART_BOX_CHART_SAMPLES + 1)
+#define P1_CHART_H          56
+
+enum
+{
+    P1_CHART_LUM = 0,
+    P1_CHART_HUMI,
+    P1_CHART_TEMP,
+    P1_CHART_GAS,
+    P1_CHART_NUM
+};
+
+static uint8_t m_chart_data[P1_CHART_NUM][P1_CHART_W];
+static lcd_chart_t m_page1_chart[P1_CHART_NUM] =
+{
+    LCD_CHART(4, P1_CHART_Y, P1_CHART_W, P1_CHART_H, 0, 30000,
+        LCD_DARKBLUE, LCD_LGRAY, m_chart_data[P1_CHART_LUM]),
+    LCD_CHART(88, P1_CHART_Y, P1_CHART_W, P1_CHART_H, 0, 10000,
+        LCD_DARKBLUE, LCD_LGRAY, m_chart_data[P1_CHART_HUMI]),
+    LCD_CHART(172, P1_CHART_Y, P1_CHART_W, P1_CHART_H, 0, 6000,
+        LCD_DARKBLUE, LCD_LGRAY, m_chart_data[P1_CHART_TEMP]),
+    LCD_CHART(256, P1_CHART_Y, P1_CHART_W, P1_CHART_H, 0, 10000,
+        LCD_DARKBLUE, LCD_LGRAY, m_chart_data[P1_CHART_GAS]),
+};
+
+/* 页面2：设置，dis2为选中项 */
+#define P2_EAT_TIME(y) \
+    LCD_WIDGET_NUMBER(141, y, 3, LCD_DARKBLUE, LCD_WHITE, 16), \
+    LCD_WIDGET_FIXED_LABEL(173, y, ":", LCD_DARKBLUE, LCD_WHITE, 16), \
+    LCD_WIDGET_NUMBER(190, y, 3, LCD_DARKBLUE, LCD_WHITE, 16)
+
+enum
+{
+    P2_BUTTON = 3,          // 开关药盒按钮，选中项0
+    P2_STORAGE = 4,         // 存储时间，共3个，选中项1~3
+    P2_EAT_TIME = 7,        // 吃药时间，共9组(时，冒号，分)，选中项4~9
+    P2_EAT_COUNT = 34,      // 吃药数量，共9个，选中项10~18
+    P2_NUM = 58
+};
+
+static lcd_widget_t m_page2[P2_NUM] =
+{
+    LCD_WIDGET_FIXED_LINE(50, 0, 50, 240, LCD_BLACK),
+    LCD_WIDGET_FIXED_LINE(140, 0, 140, 240, LCD_BLACK),
+    LCD_WIDGET_FIXED_LINE(230, 0, 230, 240, LCD_BLACK),
+    LCD_WIDGET_LABEL(0, 0, "button", LCD_DARKBLUE, LCD_WHITE, 16),
+    LCD_WIDGET_NUMBER(51, 69, 4, LCD_DARKBLUE, LCD_WHITE, 32),
+    LCD_WIDGET_NUMBER(51, 139, 4, LCD_DARKBLUE, LCD_WHITE, 32),
+    LCD_WIDGET_NUMBER(51, 209, 4, LCD_DARKBLUE, LCD_WHITE, 32),
+    /* 第一、二、三次吃药时间，每次在三个药盒区域中各显示一份 */
+    P2_EAT_TIME(31), P2_EAT_TIME(101), P2_EAT_TIME(171),
+    P2_EAT_TIME(54), P2_EAT_TIME(124), P2_EAT_TIME(194),
+    P2_EAT_TIME(78), P2_EAT_TIME(148), P2_EAT_TIME(218),
+    LCD_WIDGET_NUMBER(240, 31, 3, LCD_DARKBLUE, LCD_WHITE, 16),
+    LCD_WIDGET_NUMBER(240, 54, 3, LCD_DARKBLUE, LCD_WHITE, 16),
+    LCD_WIDGET_NUMBER(240, 78, 3, LCD_DARKBLUE, LCD_WHITE, 16),
+    LCD_WIDGET_NUMBER(240, 101, 3, LCD_DARKBLUE, LCD_WHITE, 16),
+    LCD_WIDGET_NUMBER(240, 124, 3, LCD_DARKBLUE, LCD_WHITE, 16),
+    LCD_WIDGET_NUMBER(240, 148, 3, LCD_DARKBLUE, LCD_WHITE, 16),
+    LCD_WIDGET_NUMBER(240, 171, 3, LCD_DARKBLUE, LCD_WHITE, 16),
+    LCD_WIDGET_NUMBER(240, 194, 3, LCD_DARKBLUE, LCD_WHITE, 16),
+    LCD_WIDGET_NUMBER(240, 218, 3, LCD_DARKBLUE, LCD_WHITE, 16),
+    LCD_WIDGET_FIXED_LINE(0, 30, 320, 30, LCD_BLACK),
+    LCD_WIDGET_FIXED_LINE(0, 100, 320, 100, LCD_BLACK),
+    LCD_WIDGET_FIXED_LINE(0, 170, 320, 170, LCD_BLACK),
+    LCD_WIDGET_FIXED_LINE(140, 53, 320, 53, LCD_BLACK),
+    LCD_WIDGET_FIXED_LINE(140, 77, 320, 77, LCD_BLACK),
+    LCD_WIDGET_FIXED_LINE(140, 123, 320, 123, LCD_BLACK),
+    LCD_WIDGET_FIXED_LINE(140, 147, 320, 147, LCD_BLACK),
+    LCD_WIDGET_FIXED_LINE(140, 193, 320, 193, LCD_BLACK),
+    LCD_WIDGET_FIXED_LINE(140, 217, 320, 217, LCD_BLACK),
+    LCD_WIDGET_FIXED_LABEL(60, 0, "存储时间", LCD_DARKBLUE, LCD_WHITE, 16),
+    LCD_WIDGET_FIXED_LABEL(150, 0, "吃药时间", LCD_DARKBLUE, LCD_WHITE, 16),
+    LCD_WIDGET_FIXED_LABEL(240, 0, "吃药数量", LCD_DARKBLUE, LCD_WHITE, 16),
+    LCD_WIDGET_FIXED_LABEL(0, 70, "一号", LCD_DARKBLUE, LCD_WHITE, 24),
+    LCD_WIDGET_FIXED_LABEL(0, 140, "二号", LCD_DARKBLUE, LCD_WHITE, 24),
+    LCD_WIDGET_FIXED_LABEL(0, 210, "三号", LCD_DARKBLUE, LCD_WHITE, 24),
+};
+
+/* 页面3：吃药及报警记录 */
+#define P3_HISTORY_Y        32
+#define P3_HISTORY_SIZE     16
+#define P3_HISTORY_LINES    ((LCD_H - P3_HISTORY_Y) / P3_HISTORY_SIZE)
+
+enum
+{
+    P3_NUM = 2
+};
+
+static lcd_widget_t m_page3[P3_NUM] =
+{
+    LCD_WIDGET_FIXED_LABEL(0, 2, "History", LCD_BROWN, LCD_WHITE, 24),
+    LCD_WIDGET_FIXED_LINE(0, 29, 320, 29, LCD_BLACK),
+};
+
+static char m_history_text[P3_HISTORY_LINES][LCD_CONSOLE_LINE_MAX];
+static lcd_console_t m_history = LCD_CONSOLE(0, P3_HISTORY_Y, LCD_W, P3_HISTORY_LINES,
+    LCD_DARKBLUE, LCD_WHITE, P3_HISTORY_SIZE, m_history_text);
+
+/* 显示任务：主循环只提交界面数据和记录，绘制在显示任务中进行，
+ * 绘制耗时不影响传感器读取、报警判断和上报；
+ * 界面数据只保留最新的一份，记录和绘制请求通过队列传递 */
+#define UI_QUEUE_LEN        16
+#define UI_TASK_STACK       2048
+/* 低于主循环(24)的优先级，与LCD发送任务相同 */
+#define UI_TASK_PRIO        25
+
+/* 每绘制多少次界面打印一次显示统计，0为不打印 */
+#define UI_LCD_STAT_PERIOD  20
+
+#define UI_CMD_SHOW         0       // 绘制最新的界面数据
+#define UI_CMD_HISTORY      1       // 增加一条记录
+#define UI_CMD_SENSOR       2       // 增加一组环境数据曲线采样
+
+typedef struct
+{
+    uint8_t                     type;
+    union
+    {
+        char                    text[LCD_CONSOLE_LINE_MAX];     // 记录内容(UI_CMD_HISTORY)
+        float                   sensor[P1_CHART_NUM];           // 光照、湿度、温度、烟雾(UI_CMD_SENSOR)
+    };
+} ui_cmd_t;
+
+static uint32_t m_ui_queue;
+static uint32_t m_ui_lock;              // 保护m_ui_latest和m_ui_pending
+static smart_box_ui_t m_ui_latest;      // 最新提交的界面数据
+static uint8_t  m_ui_pending = 0;       // m_ui_latest还未绘制
+static uint8_t  m_ui_started = 0;
+static uint32_t m_ui_coalesced = 0;     // 显示任务来不及绘制而合并掉的界面数据
+static uint32_t m_ui_dropped = 0;       // 队列满时丢弃的记录和曲线采样
+
+/* 是否使用预先生成的页面背景图(src/page_bg.c)
+ * 0 => 切换页面时清屏并逐个绘制固定控件
+ * 1 => 切换页面时直接显示压缩的背景图，只绘制内容变化的控件；
+ *      修改固定控件或字库后需在host目录执行make page_bg重新生成
+ * 生成背景图的程序编译时定义为0
+ */
+#ifndef UI_ENABLE_PAGE_BG
+#define UI_ENABLE_PAGE_BG   1
+#endif
+
+#if UI_ENABLE_PAGE_BG
+#define UI_PAGE_BG(bg)      (&(bg))
+#else
+#define UI_PAGE_BG(bg)      NULL
+#endif
+
+typedef struct
+{
+    lcd_widget_t               *widgets;
+    uint16_t                    count;
+    const lcd_picture_rle_t    *background;    // 页面背景图(固定控件)
+    uint8_t                     format;        // 像素格式
+} ui_page_t;
+
+/* RGB444只能准确显示各分量低位为0的颜色，深蓝、棕色等颜色和24、32号字的
+ * 抗锯齿边缘都会有偏差，现有页面都使用RGB565；只有这类颜色的纯色页面可以用RGB444 */
+
+static ui_page_t m_pages[SMART_BOX_PAGE_NUM] =
+{
+    {m_page0, P0_NUM, UI_PAGE_BG(page0_bg_rle), LCD_PIXEL_RGB565},
+    {m_page1, P1_NUM, UI_PAGE_BG(page1_bg_rle), LCD_PIXEL_RGB565},
+    {m_page2, P2_NUM, UI_PAGE_BG(page2_bg_rle), LCD_PIXEL_RGB565},
+    {m_page3, P3_NUM, UI_PAGE_BG(page3_bg_rle), LCD_PIXEL_RGB565},
+};
 
 
 /***************************************************************
@@ -41,18 +266,418 @@ void lcd_dev_init(void)
 {
     lcd_init();
     lcd_fill(0, 0, LCD_W, LCD_H, LCD_WHITE);
+    lcd_flush();
+}
+
+
+/***************************************************************
+* 函数名称: lcd_show_background
+* 说    明: 显示页面背景(固定控件)，页面中其余控件标记为需要重绘
+* 参    数:
+*       @display：页面
+*       @use_bg：1为有背景图时直接显示背景图，0为清屏后逐个绘制固定控件
+* 返 回 值: 无
+***************************************************************/
+void lcd_show_background(uint8_t display, uint8_t use_bg)
+{
+    ui_page_t *page;
+
+    if (display >= SMART_BOX_PAGE_NUM)
+    {
+        return;
+    }
+    page = &m_pages[display];
+
+    if (use_bg && (page->background != NULL))
+    {
+        /* 背景图覆盖整个屏幕，不需要先清屏 */
+        lcd_show_picture_compressed(0, 0, page->background);
+        lcd_widget_skip_fixed(page->widgets, page->count);
+    }
+    else
+    {
+        lcd_fill(0, 0, LCD_W, LCD_H, LCD_WHITE);
+        lcd_widget_draw_fixed(page->widgets, page->count);
+    }
+}
+
+
+/***************************************************************
+* 函数名称: ui_set_float
+* 说    明: 设置两位小数控件，数值限制在控件位数能显示的范围内，
+*           超出时显示最大值(如5位时为999.99)，负数显示为0
+* 参    数: w：控件
+*           value：数值
+* 返 回 值: 无
+***************************************************************/
+static void ui_set_float(lcd_widget_t *w, float value)
+{
+    int32_t max = 1;
+    uint8_t i;
+
+    for (i = 0; i < w->len; i++)
+    {
+        max *= 10;
+    }
+    max--;
+    /* 先在浮点数上比较，避免放大后超出int32_t */
+    if (value * 100 >= max)
+    {
+        lcd_widget_set(w, max, LCD_DARKBLUE, LCD_WHITE);
+    }
+    else if (value <= 0)
+    {
+        lcd_widget_set(w, 0, LCD_DARKBLUE, LCD_WHITE);
+    }
+    else
+    {
+        lcd_widget_set(w, (int32_t)(value * 100), LCD_DARKBLUE, LCD_WHITE);
+    }
+}
+
+
+/***************************************************************
+* 函数名称: lcd_show_ui
+* 说    明: 显示当前页面，只重绘内容有变化的控件
+* 参    数: ui：界面数据
+* 返 回 值: 无
+***************************************************************/
+void lcd_show_ui(const smart_box_ui_t *ui)
+{
+    static uint8_t last_display = 0xFF;
+    const unsigned char *eat[3] = {ui->eat_1, ui->eat_2, ui->eat_3};
+    ui_page_t *page;
+    uint8_t i, j;
+
+    if (ui->display >= SMART_BOX_PAGE_NUM)
+    {
+        return;
+    }
+    page = &m_pages[ui->display];
+
+    /* 休眠时LCD不显示，不绘制；显存内容保留，唤醒后只绘制休眠期间的变化 */
+    lcd_set_power(ui->power);
+    if (ui->power == LCD_POWER_SLEEP)
+    {
+        return;
+    }
+
+    /* 切换页面时先显示页面背景，之后只绘制内容变化的控件 */
+    if (ui->display != last_display)
+    {
+        lcd_console_hide(&m_history);
+        for (i = 0; i < P1_CHART_NUM; i++)
+        {
+            lcd_chart_hide(&m_page1_chart[i]);
+        }
+        lcd_set_pixel_format(page->format);
+        lcd_show_background(ui->display, UI_ENABLE_PAGE_BG);
+        last_display = ui->display;
+    }
+
+    switch (ui->display)
+    {
+        case 0:
+            for (i = 0; i < 3; i++)
+            {
+                lcd_widget_set(&m_page0[P0_COUNT + i], eat[i][ui->eat_index], LCD_DARKBLUE, LCD_WHITE);
+            }
+            lcd_widget_set(&m_page0[P0_TIME],
+                (ui->eat_time[ui->eat_index][0] << 8) | ui->eat_time[ui->eat_index][1],
+                LCD_DARKBLUE, LCD_WHITE);
+            break;
+        case 1:
+            ui_set_float(&m_page1[P1_LUM], ui->lum);
+            ui_set_float(&m_page1[P1_HUMI], ui->humi);
+            ui_set_float(&m_page1[P1_TEMP], ui->temp);
+            ui_set_float(&m_page1[P1_GAS], ui->gas);
+            lcd_widget_set(&m_page1[P1_TIME], (ui->hour << 8) | ui->min, LCD_DARKBLUE, LCD_WHITE);
+            break;
+        case 2:
+            lcd_widget_set(&m_page2[P2_BUTTON], 0, LCD_DARKBLUE, UI_BC(ui, 0));
+            for (i = 0; i < 3; i++)
+            {
+                lcd_widget_set(&m_page2[P2_STORAGE + i], ui->storage_time[i], LCD_DARKBLUE, UI_BC(ui, 1 + i));
+            }
+            /* 第i次吃药时间在三个药盒中各显示一次 */
+            for (i = 0; i < 3; i++)
+            {
+                for (j = 0; j < 3; j++)
+                {
+                    lcd_widget_t *w = &m_page2[P2_EAT_TIME + (i * 3 + j) * 3];
+
+                    lcd_widget_set(&w[0], ui->eat_time[i][0], LCD_DARKBLUE, UI_BC(ui, 4 + i * 2));
+                    lcd_widget_set(&w[2], ui->eat_time[i][1], LCD_DARKBLUE, UI_BC(ui, 5 + i * 2));
+                }
+            }
+            for (i = 0; i < 3; i++)
+            {
+                for (j = 0; j < 3; j++)
+                {
+                    lcd_widget_set(&m_page2[P2_EAT_COUNT + i * 3 + j], eat[i][j],
+                        LCD_DARKBLUE, UI_BC(ui, 10 + i * 3 + j));
+                }
+            }
+            break;
+        default:
+            break;
+    }
+
+    lcd_widget_render(page->widgets, page->count);
+    if (ui->display == 1)
+    {
+        /* 只绘制新增的采样 */
+        for (i = 0; i < P1_CHART_NUM; i++)
+        {
+            lcd_chart_render(&m_page1_chart[i]);
+        }
+    }
+    if (ui->display == 3)
+    {
+        /* 只绘制新增的记录 */
+        lcd_console_render(&m_history);
+    }
+    /* 只把本次有变化的区域刷新到屏幕 */
+    lcd_flush();
+}
+
+
+
+
+/***************************************************************
+* 函数名称: lcd_add_history
+* 说    明: 增加一条吃药或报警记录，显示记录页面时只绘制新增的一行
+* 参    数: text：记录内容
+* 返 回 值: 无
+***************************************************************/
+void lcd_add_history(const char *text)
+{
+    lcd_console_add(&m_history, text);
 }
 
 
 /***************************************************************
-* 函数名称: lcd_load_ui
-* 说    明: 加载lcd ui
+* 函数名称: lcd_add_sensor
+* 说    明: 增加一组环境数据曲线采样，显示环境页面时只绘制新增的一列
+* 参    数:
+*       @lum：光照
+*       @humi：湿度
+*       @temp：温度
+*       @gas：烟雾浓度
+* 返 回 值: 无
+***************************************************************/
+void lcd_add_sensor(float lum, float humi, float temp, float gas)
+{
+    lcd_chart_add(&m_page1_chart[P1_CHART_LUM], (int32_t)(lum * 100));
+    lcd_chart_add(&m_page1_chart[P1_CHART_HUMI], (int32_t)(humi * 100));
+    lcd_chart_add(&m_page1_chart[P1_CHART_TEMP], (int32_t)(temp * 100));
+    lcd_chart_add(&m_page1_chart[P1_CHART_GAS], (int32_t)(gas * 100));
+}
+
+
+/***************************************************************
+* 函数名称: smart_box_display_thread
+* 说    明: 显示任务，先处理队列中积压的全部记录，再绘制最新的界面数据
+* 参    数:
+*       @arg：未使用
+* 返 回 值: 无
+***************************************************************/
+static void *smart_box_display_thread(uint32_t arg)
+{
+    ui_cmd_t cmd;
+    smart_box_ui_t ui;
+    uint32_t size;
+    uint8_t show;
+#if UI_LCD_STAT_PERIOD
+    uint32_t stat_count = 0;
+    char tag[64];
+#endif
+
+    (void)arg;
+    lcd_dev_init();
+
+    while (1)
+    {
+        size = sizeof(cmd);
+        if (LOS_QueueReadCopy(m_ui_queue, &cmd, &size, LOS_WAIT_FOREVER) != LOS_OK)
+        {
+            continue;
+        }
+        do
+        {
+            if (cmd.type == UI_CMD_HISTORY)
+            {
+                lcd_add_history(cmd.text);
+            }
+            else if (cmd.type == UI_CMD_SENSOR)
+            {
+                lcd_add_sensor(cmd.sensor[P1_CHART_LUM], cmd.sensor[P1_CHART_HUMI],
+                    cmd.sensor[P1_CHART_TEMP], cmd.sensor[P1_CHART_GAS]);
+            }
+            size = sizeof(cmd);
+        } while (LOS_QueueReadCopy(m_ui_queue, &cmd, &size, LOS_NO_WAIT) == LOS_OK);
+
+        LOS_SemPend(m_ui_lock, LOS_WAIT_FOREVER);
+        show = m_ui_pending;
+        ui = m_ui_latest;
+        m_ui_pending = 0;
+        LOS_SemPost(m_ui_lock);
+        if (!show)
+        {
+            continue;
+        }
+        lcd_show_ui(&ui);
+
+#if UI_LCD_STAT_PERIOD
+        /* 定期打印显示统计，查看各页面和绘图函数占用的显示时间 */
+        if (++stat_count >= UI_LCD_STAT_PERIOD)
+        {
+            stat_count = 0;
+            snprintf(tag, sizeof(tag), "[sc display] page%d coalesced %u dropped %u",
+                ui.display, m_ui_coalesced, m_ui_dropped);
+            lcd_stat_print(tag);
+            lcd_stat_reset();
+        }
+#endif
+    }
+    return NULL;
+}
+
+
+/***************************************************************
+* 函数名称: smart_box_display_init
+* 说    明: 创建显示队列和显示任务，LCD在显示任务中初始化
 * 参    数: 无
+* 返 回 值: 返回0为成功，反之为失败
+***************************************************************/
+unsigned int smart_box_display_init(void)
+{
+    TSK_INIT_PARAM_S task = {0};
+    uint32_t task_id;
+
+    if (m_ui_started)
+    {
+        return 0;
+    }
+
+    if ((LOS_QueueCreate("uiQ", UI_QUEUE_LEN, &m_ui_queue, 0, sizeof(ui_cmd_t)) != LOS_OK)
+        || (LOS_SemCreate(1, &m_ui_lock) != LOS_OK))
+    {
+        printf("%s, %s, %d: Display queue init failed!\n",
+         __FILE__, __func__, __LINE__);
+        return IOT_FAILURE;
+    }
+
+    task.pfnTaskEntry = smart_box_display_thread;
+    task.uwStackSize = UI_TASK_STACK;
+    task.pcName = "display thread";
+    task.usTaskPrio = UI_TASK_PRIO;
+    if (LOS_TaskCreate(&task_id, &task) != LOS_OK)
+    {
+        printf("%s, %s, %d: Display task create failed!\n",
+         __FILE__, __func__, __LINE__);
+        return IOT_FAILURE;
+    }
+
+    m_ui_started = 1;
+    return 0;
+}
+
+
+/***************************************************************
+* 函数名称: smart_box_display_show
+* 说    明: 提交一份界面数据，不等待绘制；显示任务来不及绘制时
+*           之前未绘制的数据被新数据覆盖，只绘制最新的一份
+* 参    数: ui：界面数据
 * 返 回 值: 无
 ***************************************************************/
-void lcd_show_ui(void)
+void smart_box_display_show(const smart_box_ui_t *ui)
 {
-        
+    ui_cmd_t cmd;
+    uint8_t pending;
+
+    if (!m_ui_started)
+    {
+        return;
+    }
+
+    LOS_SemPend(m_ui_lock, LOS_WAIT_FOREVER);
+    pending = m_ui_pending;
+    m_ui_latest = *ui;
+    m_ui_pending = 1;
+    LOS_SemPost(m_ui_lock);
+
+    if (pending)
+    {
+        /* 已有一个绘制请求在队列中 */
+        m_ui_coalesced++;
+        return;
+    }
+    cmd.type = UI_CMD_SHOW;
+    if (LOS_QueueWriteCopy(m_ui_queue, &cmd, sizeof(cmd), LOS_NO_WAIT) != LOS_OK)
+    {
+        /* 队列中没有绘制请求，清除标志，下次提交时重新发送 */
+        LOS_SemPend(m_ui_lock, LOS_WAIT_FOREVER);
+        m_ui_pending = 0;
+        LOS_SemPost(m_ui_lock);
+        m_ui_dropped++;
+    }
 }
 
 
+/***************************************************************
+* 函数名称: smart_box_display_history
+* 说    明: 提交一条吃药或报警记录，不等待；队列满时丢弃
+* 参    数: text：记录内容
+* 返 回 值: 无
+***************************************************************/
+void smart_box_display_history(const char *text)
+{
+    ui_cmd_t cmd;
+
+    if (!m_ui_started)
+    {
+        return;
+    }
+
+    cmd.type = UI_CMD_HISTORY;
+    strncpy(cmd.text, text, sizeof(cmd.text) - 1);
+    cmd.text[sizeof(cmd.text) - 1] = '\0';
+    if (LOS_QueueWriteCopy(m_ui_queue, &cmd, sizeof(cmd), LOS_NO_WAIT) != LOS_OK)
+    {
+        m_ui_dropped++;
+        printf("%s, %s, %d: display queue full, history dropped: %s\n",
+            __FILE__, __func__, __LINE__, text);
+    }
+}
+
+
+/***************************************************************
+* 函数名称: smart_box_display_sensor
+* 说    明: 提交一组环境数据曲线采样，不等待；队列满时丢弃
+* 参    数:
+*       @lum：光照
+*       @humi：湿度
+*       @temp：温度
+*       @gas：烟雾浓度
+* 返 回 值: 无
+***************************************************************/
+void smart_box_display_sensor(float lum, float humi, float temp, float gas)
+{
+    ui_cmd_t cmd;
+
+    if (!m_ui_started)
+    {
+        return;
+    }
+
+    cmd.type = UI_CMD_SENSOR;
+    cmd.sensor[P1_CHART_LUM] = lum;
+    cmd.sensor[P1_CHART_HUMI] = humi;
+    cmd.sensor[P1_CHART_TEMP] = temp;
+    cmd.sensor[P1_CHART_GAS] = gas;
+    if (LOS_QueueWriteCopy(m_ui_queue, &cmd, sizeof(cmd), LOS_NO_WAIT) != LOS_OK)
+    {
+        m_ui_dropped++;
+    }
+}
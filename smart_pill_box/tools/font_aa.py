@@ -0,0 +1,70 @@
+# Copyright (c) 2024 iSoftStone Education Co., Ltd.
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+"""Anti-aliasing of 1bpp glyphs, used by font_subset.py.
+
+A glyph is upscaled 4x with Scale2x applied twice, which rounds off
+diagonal staircases, then box-filtered back to its original size. The
+coverage of each pixel becomes a 4-bit alpha: 0 is background, 15 is
+foreground.
+
+Packed layout matches lcd_font.h: rows top to bottom, (sizex + 1) / 2
+bytes per row, the left pixel in the high nibble.
+"""
+
+SCALE = 4
+
+
+def unpack(data, sizex, sizey):
+    row_bytes = (sizex + 7) // 8
+    return [[(data[y * row_bytes + (x >> 3)] >> (x & 7)) & 1 for x in range(sizex)]
+            for y in range(sizey)]
+
+
+def scale2x(img):
+    h, w = len(img), len(img[0])
+
+    def at(x, y):
+        return img[y][x] if 0 <= x < w and 0 <= y < h else 0
+
+    out = [[0] * (w * 2) for _ in range(h * 2)]
+    for y in range(h):
+        for x in range(w):
+            p = img[y][x]
+            a, b, c, d = at(x, y - 1), at(x + 1, y), at(x - 1, y), at(x, y + 1)
+            out[y * 2][x * 2] = a if (c == a and c != d and a != b) else p
+            out[y * 2][x * 2 + 1] = b if (a == b and a != c and b != d) else p
+            out[y * 2 + 1][x * 2] = c if (d == c and d != b and c != a) else p
+            out[y * 2 + 1][x * 2 + 1] = d if (b == d and b != a and d != c) else p
+    return out
+
+
+def antialias(data, sizex, sizey):
+    big = unpack(data, sizex, sizey)
+    for _ in range(SCALE // 2):
+        big = scale2x(big)
+    alpha = []
+    for y in range(sizey):
+        row = []
+        for x in range(sizex):
+            cover = sum(big[y * SCALE + j][x * SCALE + i] for j in range(SCALE) for i in range(SCALE))
+            row.append((cover * 15 + SCALE * SCALE // 2) // (SCALE * SCALE))
+        alpha.append(row)
+    return alpha
+
+
+def pack(alpha, sizex):
+    out = []
+    for row in alpha:
+        padded = row + [0] * (sizex & 1)
+        out.extend((padded[i] << 4) | padded[i + 1] for i in range(0, len(padded), 2))
+    return out
@@ -0,0 +1,180 @@
+#!/usr/bin/env python3
+# Copyright (c) 2024 iSoftStone Education Co., Ltd.
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+"""Generate the subsetted font used by the firmware.
+
+Collects every character that appears in a string or character literal of
+the scanned C sources, plus --always (digits and the characters used by the
+number formatting code), and keeps only those glyphs of the fonts in the
+source file (ascii_<sizey><sizex> and tfont<sizey>, as written by the font
+tool). Fonts listed in --aa-sizes also get a 4bpp anti-aliased copy of each
+kept glyph, see font_aa.py.
+
+Output is one C file defining `lcd_fonts[]` (see lcd_font.h): per font the
+unicode codes of its glyphs in ascending order, the 1bpp glyphs in the same
+order and the optional 4bpp glyphs.
+
+A source given as `file.c:func1,func2` only contributes the literals passed
+to calls of those functions, for files that also hold log messages. In the
+other sources the literals passed to --ignore functions (printf-like log
+output) are skipped.
+"""
+
+import argparse
+import codecs
+import re
+import sys
+
+import font_aa
+
+COMMENT_RE = re.compile(r'/\*.*?\*/|//[^\n]*', re.S)
+INCLUDE_RE = re.compile(r'^\s*#\s*include[^\n]*', re.M)
+LITERAL_RE = re.compile(r'"((?:[^"\\\n]|\\.)*)"|\'((?:[^\'\\\n]|\\.)+)\'')
+ASCII_RE = re.compile(r'const\s+unsigned\s+char\s+ascii_(\d\d)(\d\d)\s*\[\s*\]\s*\[\s*(\d+)\s*\]\s*=\s*\{(.*?)\n\};', re.S)
+CN_RE = re.compile(r'const\s+typFNT_GB(\d+)\s+tfont\1\s*\[\s*\]\s*=\s*\{(.*?)\n\};', re.S)
+BYTE_RE = re.compile(r'0[xX][0-9a-fA-F]+|\d+')
+ENTRY_RE = re.compile(r'"([^"]*)"\s*,([^"]*)')
+
+ASCII_FIRST = 0x20
+
+
+def parse_fonts(text):
+    """Return [(name, sizex, sizey, {code: glyph bytes})] in source order."""
+    text = COMMENT_RE.sub('', text)
+    fonts = []
+    for m in ASCII_RE.finditer(text):
+        sizey, sizex, stride = int(m.group(1)), int(m.group(2)), int(m.group(3))
+        glyphs = {}
+        for i, body in enumerate(re.findall(r'\{([^{}]*)\}', m.group(4))):
+            data = [int(v, 0) for v in BYTE_RE.findall(body)]
+            if len(data) != stride:
+                raise ValueError('ascii_%d%02d: glyph %d has %d bytes, expected %d'
+                                 % (sizey, sizex, i, len(data), stride))
+            glyphs[ASCII_FIRST + i] = data
+        fonts.append(('ascii_%d%02d' % (sizey, sizex), sizex, sizey, glyphs))
+    for m in CN_RE.finditer(text):
+        size = int(m.group(1))
+        stride = (size + 7) // 8 * size
+        glyphs = {}
+        for char, body in ENTRY_RE.findall(m.group(2)):
+            data = [int(v, 0) for v in BYTE_RE.findall(body)]
+            if len(char) != 1 or len(data) != stride:
+                raise ValueError('tfont%d: glyph "%s" has %d bytes, expected %d'
+                                 % (size, char, len(data), stride))
+            # the first of duplicated glyphs wins
+            glyphs.setdefault(ord(char), data)
+        fonts.append(('tfont%d' % size, size, size, glyphs))
+    return fonts
+
+
+def call_spans(text, funcs):
+    """Yield (start, end) of the argument text of every call of funcs."""
+    for m in re.finditer(r'\b(?:%s)\s*\(' % '|'.join(re.escape(f) for f in funcs), text):
+        depth, i = 1, m.end()
+        while depth and i < len(text):
+            lit = LITERAL_RE.match(text, i)
+            if lit:
+                i = lit.end()
+                continue
+            depth += {'(': 1, ')': -1}.get(text[i], 0)
+            i += 1
+        yield m.end(), i - 1
+
+
+def scan_chars(specs, ignore):
+    """Return the set of characters used in C string and character literals."""
+    chars = set()
+    for spec in specs:
+        path, _, funcs = spec.partition(':')
+        with open(path, encoding='utf-8') as f:
+            text = INCLUDE_RE.sub('', COMMENT_RE.sub('', f.read()))
+        if funcs:
+            text = '\n'.join(text[a:b] for a, b in call_spans(text, funcs.split(',')))
+        elif ignore:
+            for a, b in reversed(list(call_spans(text, ignore))):
+                text = text[:a] + text[b:]
+        for m in LITERAL_RE.finditer(text):
+            literal = m.group(1) if m.group(1) is not None else m.group(2)
+            value = codecs.escape_decode(literal.encode('utf-8'))[0].decode('utf-8', 'replace')
+            chars.update(c for c in value if c.isprintable())
+    return chars
+
+
+def format_array(values, fmt, per_line):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append('    ' + ', '.join(fmt % v for v in values[i:i + per_line]) + ',')
+    return '\n'.join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('input', help='font source with the 1bpp fonts')
+    parser.add_argument('output', help='generated C file')
+    parser.add_argument('sources', nargs='+', help='C files whose literals are drawn on the LCD, optionally file.c:func1,func2')
+    parser.add_argument('--always', default=' 0123456789.:-',
+                        help='characters kept even if no literal uses them (default: digits and " .:-")')
+    parser.add_argument('--ignore', default='printf,snprintf',
+                        help='comma separated functions whose literals are not drawn (default: printf,snprintf)')
+    parser.add_argument('--aa-sizes', default='24,32',
+                        help='comma separated font sizes with anti-aliased glyphs (default: 24,32, empty for none)')
+    args = parser.parse_args()
+
+    aa_sizes = [int(s) for s in args.aa_sizes.split(',') if s.strip()]
+    with open(args.input, encoding='utf-8') as f:
+        fonts = parse_fonts(f.read())
+    codes = set(ord(c) for c in scan_chars(args.sources, [f for f in args.ignore.split(',') if f]) | set(args.always))
+
+    missing = sorted(c for c in codes if not any(c in glyphs for _, _, _, glyphs in fonts))
+    if missing:
+        sys.stderr.write('warning: no glyph for %s\n' % ' '.join(chr(c) for c in missing))
+
+    out = ['/* Generated by tools/font_subset.py from %s, do not edit. */' % args.input.replace('\\', '/').split('/')[-1],
+           '#include <stddef.h>',
+           '#include "lcd_font.h"',
+           '']
+    entries = []
+    total = 0
+    for name, sizex, sizey, glyphs in fonts:
+        used = sorted(c for c in codes if c in glyphs)
+        if not used:
+            continue
+        data = []
+        for c in used:
+            data.extend(glyphs[c])
+        out.append('/* %s: %d of %d glyphs %dx%d: %s */' % (name, len(used), len(glyphs), sizex, sizey,
+                                                           ''.join(chr(c) for c in used).replace('*/', '* /')))
+        out.append('static const uint16_t m_%s_codes[%d] =\n{\n%s\n};\n' % (name, len(used), format_array(used, '0x%04X', 12)))
+        out.append('static const uint8_t m_%s_glyphs[%d] =\n{\n%s\n};\n' % (name, len(data), format_array(data, '0x%02X', 16)))
+        aa = 'NULL'
+        total += len(used) * 2 + len(data)
+        if sizey in aa_sizes:
+            aa_data = []
+            for c in used:
+                aa_data.extend(font_aa.pack(font_aa.antialias(glyphs[c], sizex, sizey), sizex))
+            out.append('static const uint8_t m_%s_aa[%d] =\n{\n%s\n};\n' % (name, len(aa_data), format_array(aa_data, '0x%02X', 16)))
+            aa = 'm_%s_aa' % name
+            total += len(aa_data)
+        entries.append('    {%d, %d, %d, m_%s_codes, m_%s_glyphs, %s},' % (sizex, sizey, len(used), name, name, aa))
+
+    out.append('/* %d bytes */' % total)
+    out.append('const lcd_font_t lcd_fonts[] =\n{\n%s\n};\n' % '\n'.join(entries))
+    out.append('const uint8_t lcd_font_num = sizeof(lcd_fonts) / sizeof(lcd_fonts[0]);\n')
+
+    with open(args.output, 'w', encoding='utf-8', newline='\n') as f:
+        f.write('\n'.join(out))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
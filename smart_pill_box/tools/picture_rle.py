@@ -0,0 +1,142 @@
+#!/usr/bin/env python3
+# Copyright (c) 2024 iSoftStone Education Co., Ltd.
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+"""Convert Image2Lcd RGB565 arrays into palette + RLE pictures.
+
+Reads every `const unsigned char <name>[] = {...};` array from the input C
+file (8-byte Image2Lcd header followed by big-endian RGB565 pixels) and
+writes a C file defining `const lcd_picture_rle_t <name>_rle` for each of
+them, to be drawn with lcd_show_picture_compressed().
+
+Stream format: a control byte c, then
+  c & 0x80: a run of (c & 0x7F) + 1 pixels, followed by one palette index
+  else    : (c & 0x7F) + 1 literal pixels, each one palette index
+"""
+
+import argparse
+import re
+import sys
+
+HEADER_LEN = 8
+MAX_PACKET = 128
+MAX_PALETTE = 256
+
+ARRAY_RE = re.compile(r'const\s+unsigned\s+char\s+(\w+)\s*\[\s*\d*\s*\]\s*=\s*\{(.*?)\};', re.S)
+BYTE_RE = re.compile(r'0[xX][0-9a-fA-F]+|\d+')
+
+
+def parse_pictures(text):
+    pictures = []
+    for m in ARRAY_RE.finditer(text):
+        data = [int(v, 0) for v in BYTE_RE.findall(m.group(2))]
+        if len(data) < HEADER_LEN:
+            raise ValueError('%s: missing Image2Lcd header' % m.group(1))
+        width = (data[2] << 8) | data[3]
+        height = (data[4] << 8) | data[5]
+        body = data[HEADER_LEN:]
+        if len(body) != width * height * 2:
+            raise ValueError('%s: %dx%d needs %d bytes, found %d'
+                             % (m.group(1), width, height, width * height * 2, len(body)))
+        pixels = [(body[i] << 8) | body[i + 1] for i in range(0, len(body), 2)]
+        pictures.append((m.group(1), width, height, pixels))
+    return pictures
+
+
+def encode(pixels):
+    palette = []
+    lookup = {}
+    for color in pixels:
+        if color not in lookup:
+            lookup[color] = len(palette)
+            palette.append(color)
+    if len(palette) > MAX_PALETTE:
+        raise ValueError('%d colors, at most %d supported' % (len(palette), MAX_PALETTE))
+
+    index = [lookup[c] for c in pixels]
+    out = []
+    literal = []
+
+    def flush_literal():
+        while literal:
+            chunk = literal[:MAX_PACKET]
+            del literal[:MAX_PACKET]
+            out.append(len(chunk) - 1)
+            out.extend(chunk)
+
+    i = 0
+    while i < len(index):
+        run = 1
+        while i + run < len(index) and index[i + run] == index[i] and run < MAX_PACKET:
+            run += 1
+        if run >= 2:
+            flush_literal()
+            out.append(0x80 | (run - 1))
+            out.append(index[i])
+        else:
+            literal.append(index[i])
+        i += run
+    flush_literal()
+    return palette, out
+
+
+def decode(palette, data):
+    pixels = []
+    i = 0
+    while i < len(data):
+        count = (data[i] & 0x7F) + 1
+        if data[i] & 0x80:
+            pixels.extend([palette[data[i + 1]]] * count)
+            i += 2
+        else:
+            pixels.extend(palette[p] for p in data[i + 1:i + 1 + count])
+            i += 1 + count
+    return pixels
+
+
+def format_array(values, fmt, per_line):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append('    ' + ', '.join(fmt % v for v in values[i:i + per_line]) + ',')
+    return '\n'.join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('input', help='C file with Image2Lcd RGB565 arrays')
+    parser.add_argument('output', help='generated C file')
+    args = parser.parse_args()
+
+    with open(args.input, encoding='utf-8') as f:
+        pictures = parse_pictures(f.read())
+
+    out = ['/* Generated by tools/picture_rle.py from %s, do not edit. */' % args.input.replace('\\', '/').split('/')[-1],
+           '#include "picture.h"', '']
+    for name, width, height, pixels in pictures:
+        palette, data = encode(pixels)
+        assert decode(palette, data) == pixels
+        out.append('/* %s: %dx%d, %d colors, %d -> %d bytes */'
+                   % (name, width, height, len(palette), width * height * 2, len(palette) * 2 + len(data)))
+        out.append('static const uint16_t %s_palette[%d] =\n{\n%s\n};\n'
+                   % (name, len(palette), format_array(palette, '0x%04X', 8)))
+        out.append('static const uint8_t %s_data[%d] =\n{\n%s\n};\n'
+                   % (name, len(data), format_array(data, '0x%02X', 16)))
+        out.append('const lcd_picture_rle_t %s_rle =\n{\n    %d, %d, %d, %s_palette, %d, %s_data,\n};\n'
+                   % (name, width, height, len(palette), name, len(data), name))
+
+    with open(args.output, 'w', encoding='utf-8', newline='\n') as f:
+        f.write('\n'.join(out))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())